@@ -13,6 +13,7 @@
 #include "Engine/AssetManagerTypes.h"
 #include "Misc/SecureHash.h"
 #include "Internationalization/Regex.h"
+#include "ObjectPooling/PulseObjectPooling.h"
 //#include "JsonObjectConverter.h"
 //#include "Engine/NetworkObjectList.h"
 
@@ -297,6 +298,9 @@ bool UPulseSystemLibrary::IsActorEnabled(const AActor* Actor)
 {
 	if (!Actor)
 		return false;
+	// Pooled actors sleep without the tag, the pool knows their state.
+	if (const auto pooling = UPulseObjectPooling::Get(Actor); pooling && pooling->IsPooledActorDormant(Actor))
+		return false;
 	return !Actor->ActorHasTag("PulseActorDisabled");
 }
 
@@ -9,6 +9,101 @@
 #include "Interfaces/IHttpResponse.h"
 
 
+FPulseChunkFileWriter::FPulseChunkFileWriter(const FString& Path, int64 ExistingSize, int64 MaxBytes, int32 BufferSize, EPulseDownloadHash HashType)
+	: _remainingBytes(FMath::Max<int64>(MaxBytes, 0))
+	  , _bufferSize(FMath::Max(BufferSize, 4096))
+	  , _hasher(HashType)
+	  // Hashing a resumed chunk would first read its bytes back on the http thread. The merge thread reads them anyway.
+	  , _bHashValid(HashType != EPulseDownloadHash::None && ExistingSize <= 0)
+{
+	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+	PF.CreateDirectoryTree(*FPaths::GetPath(Path));
+	_fileHandle.Reset(PF.OpenWrite(*Path, true));
+	_buffer.Reserve(_bufferSize);
+}
+
+FPulseChunkFileWriter::~FPulseChunkFileWriter()
+{
+	Close();
+}
+
+bool FPulseChunkFileWriter::IsOpen() const
+{
+	FScopeLock lock(&_lock);
+	return _fileHandle.IsValid();
+}
+
+bool FPulseChunkFileWriter::Receive(const uint8* Data, int64 Length)
+{
+	FScopeLock lock(&_lock);
+	if (_bFailed || !_fileHandle.IsValid())
+		return false;
+	// Never write past the chunk end, a server ignoring the range would otherwise spill into the chunk file.
+	const int64 accepted = FMath::Min(Length, _remainingBytes);
+	_remainingBytes -= accepted;
+	if (_buffer.Num() + accepted > _bufferSize && !Flush_Internal())
+		return false;
+	if (accepted >= _bufferSize)
+	{
+		// Too large to be buffered, write it through.
+		if (!Write_Internal(Data, accepted))
+			return false;
+	}
+	else if (accepted > 0)
+	{
+		_buffer.Append(Data, accepted);
+	}
+	return accepted == Length;
+}
+
+void FPulseChunkFileWriter::Close()
+{
+	FScopeLock lock(&_lock);
+	if (!_fileHandle.IsValid())
+		return;
+	if (!_bFailed)
+		Flush_Internal();
+	_fileHandle->Flush();
+	_fileHandle.Reset();
+	_buffer.Empty();
+	if (_bHashValid && !_bFailed)
+		_leafDigests = _hasher.Finish();
+}
+
+int64 FPulseChunkFileWriter::GetWrittenSize() const
+{
+	FScopeLock lock(&_lock);
+	return _writtenBytes;
+}
+
+TArray<uint8> FPulseChunkFileWriter::GetLeafDigests() const
+{
+	FScopeLock lock(&_lock);
+	return _leafDigests;
+}
+
+bool FPulseChunkFileWriter::Flush_Internal()
+{
+	if (_buffer.IsEmpty())
+		return true;
+	const bool bWritten = Write_Internal(_buffer.GetData(), _buffer.Num());
+	_buffer.Reset();
+	return bWritten;
+}
+
+bool FPulseChunkFileWriter::Write_Internal(const uint8* Data, int64 Length)
+{
+	if (!_fileHandle.IsValid() || !_fileHandle->Write(Data, Length))
+	{
+		_bFailed = true;
+		return false;
+	}
+	_writtenBytes += Length;
+	if (_bHashValid)
+		_hasher.Update(Data, Length);
+	return true;
+}
+
 bool UPulseDownloadChunk::IsValid() const
 {
 	return !ChunkPath.IsEmpty() && FileEndByte > 0 && FileEndByte > GetActiveRange().X;
@@ -65,13 +160,43 @@ void UPulseDownloadChunk::InitializeChunk(const FString& LocalPath, int32 ChunkI
 
 bool UPulseDownloadChunk::StartChunk(const FString& Url)
 {
-	if (!IsValid())
-		return false;
 	if (IsActive())
 		return false;
+	// Resume from what actually reached the disk, not from what the last request reported.
+	LocalSize = FMath::Max(GetLocalSize(), 0);
+	DownloadedSize = 0;
+	if (LocalSize > GetTargetSize())
+	{
+		FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*ChunkPath);
+		LocalSize = 0;
+	}
+	if (!IsValid())
+		return false;
 	if (IsCompleted())
 		return false;
+	bCancelRequested = false;
+	Writer = MakeShared<FPulseChunkFileWriter>(ChunkPath, LocalSize, GetTargetSize() - LocalSize, WriteBufferSize, HashType);
+	LeafDigests.Empty();
+	ChunkHash.Empty();
+	if (!Writer->IsOpen())
+	{
+		UE_LOG(LogPulseDownloader, Error, TEXT("Chunk %d Start Failed: Unable to open chunk file (Chunk path: %s)"), GetChunkIndex(), *ChunkPath);
+		Writer.Reset();
+		return false;
+	}
 	Request = MakeDownloadRequest(Url, GetActiveRange());
+	// The body is streamed to the chunk file from the http thread, it's never held whole in memory.
+	TWeakPtr<FPulseChunkFileWriter> weakWriter = Writer;
+	TWeakPtr<IHttpRequest> weakRequest = Request;
+	const int64 rangeStart = GetActiveRange().X;
+	Request->SetResponseBodyReceiveStreamDelegateV2(FHttpRequestStreamDelegateV2::CreateLambda([weakWriter, weakRequest, rangeStart](void* Ptr, int64& Length)-> void
+	{
+		const auto writer = weakWriter.Pin();
+		const auto request = weakRequest.Pin();
+		const auto response = request ? request->GetResponse() : nullptr;
+		if (!writer || !response || !IsExpectedResponse(response->GetResponseCode(), rangeStart) || !writer->Receive(static_cast<const uint8*>(Ptr), Length))
+			Length = 0;
+	}));
 	if (!Request->OnRequestProgress64().IsBound())
 	{
 		Request->OnRequestProgress64().BindUObject(this, &UPulseDownloadChunk::OnChunkUpdateCallback);
@@ -80,6 +205,8 @@ bool UPulseDownloadChunk::StartChunk(const FString& Url)
 	{
 		Request->OnProcessRequestComplete().BindUObject(this, &UPulseDownloadChunk::OnChunkCompletedCallback);
 	}
+	RequestStartTime = FPlatformTime::Seconds();
+	FirstByteTime = 0;
 	Request->ProcessRequest();
 	return true;
 }
@@ -87,47 +214,79 @@ bool UPulseDownloadChunk::StartChunk(const FString& Url)
 bool UPulseDownloadChunk::CancelChunk()
 {
 	if (Request.IsValid())
+	{
+		bCancelRequested = true;
 		Request->CancelRequest();
+	}
 	else
+	{
 		OnChunkFailed.Broadcast(this);
+	}
 	return true;
 }
 
+void UPulseDownloadChunk::ReleaseChunkFile()
+{
+	if (!Writer.IsValid())
+		return;
+	Writer->Close();
+	LeafDigests = Writer->GetLeafDigests();
+	Writer.Reset();
+}
+
 void UPulseDownloadChunk::OnChunkUpdateCallback(FHttpRequestPtr Req, uint64 BytesSent, uint64 BytesReceived)
 {
+	if (BytesReceived > 0 && FirstByteTime <= 0)
+		FirstByteTime = FPlatformTime::Seconds();
+	UnsampledBytes += FMath::Max<int64>(static_cast<int64>(BytesReceived) - DownloadedSize, 0);
 	DownloadedSize = BytesReceived;
 	OnChunkUpdate.Broadcast(this);
 }
 
 void UPulseDownloadChunk::OnChunkCompletedCallback(TSharedPtr<IHttpRequest> Req, TSharedPtr<IHttpResponse> Response, bool success)
 {
-	TArray<uint8> Data = Response ? Response->GetContent() : TArray<uint8>();
-	if (Data.Num() > 0)
-	{
-		TUniquePtr<IFileHandle> FileHandle;
-		IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
-		FileHandle.Reset(PF.OpenWrite(*ChunkPath, true));
-		if (FileHandle.IsValid())
-			FileHandle->Write(Data.GetData(), Data.Num());
-		else
-			FFileHelper::SaveArrayToFile(Data, *ChunkPath);
-		FileHandle.Reset();
-	}
+	const int64 writtenSize = Writer.IsValid() ? Writer->GetWrittenSize() : 0;
+	ReleaseChunkFile();
 	Request->OnRequestProgress64().Unbind();
 	Request->OnProcessRequestComplete().Unbind();
 	Request.Reset();
+	LastRequestBytes = writtenSize;
+	LastRequestSeconds = FPlatformTime::Seconds() - RequestStartTime;
+	LastRequestLatency = FirstByteTime > 0 ? FirstByteTime - RequestStartTime : 0;
 	const auto chunkIndex = GetChunkIndex();
-	const auto diskSize = GetLocalSize();
+	const auto diskSize = FMath::Max(GetLocalSize(), 0);
 	const bool completed = IsCompleted();
-	UE_LOG(LogPulseDownloader, Log, TEXT("Chunk %d Download %s: %s/%s ; %s On disk, %s Response (Chunk path: %s)"), chunkIndex,
-	       *FString(completed? TEXT("completed") : TEXT("partially completed")), *UPulseSystemLibrary::FileSizeToString(DownloadedSize + LocalSize),
+	UE_LOG(LogPulseDownloader, Log, TEXT("Chunk %d Download %s: %s/%s ; %s On disk, %s Written (Chunk path: %s)"), chunkIndex,
+	       *FString(completed? TEXT("completed") : TEXT("partially completed")), *UPulseSystemLibrary::FileSizeToString(diskSize),
 	       *UPulseSystemLibrary::FileSizeToString(GetTargetSize()),
-	       *UPulseSystemLibrary::FileSizeToString(diskSize), *UPulseSystemLibrary::FileSizeToString(sizeof(uint8) * Data.Num()),
+	       *UPulseSystemLibrary::FileSizeToString(diskSize), *UPulseSystemLibrary::FileSizeToString(writtenSize),
 	       *ChunkPath);
+	// What reached the disk is now the local part, the next request resumes from there.
+	LocalSize = diskSize;
+	DownloadedSize = 0;
+	if (completed && !LeafDigests.IsEmpty())
+		ChunkHash = FPulseTreeHasher::DigestLeaves(HashType, LeafDigests);
+	else
+		LeafDigests.Empty();
 	if (completed)
+	{
 		OnChunkCompleted.Broadcast(this);
+	}
 	else
+	{
+		if (!bCancelRequested)
+			FailCount++;
 		OnChunkFailed.Broadcast(this);
+	}
+	bCancelRequested = false;
+}
+
+bool UPulseDownloadChunk::IsExpectedResponse(int32 StatusCode, int64 RangeStart)
+{
+	// An error body, or a whole file sent for a range that doesn't start at zero, must not reach the chunk file.
+	if (StatusCode == 206)
+		return true;
+	return StatusCode / 100 == 2 && RangeStart <= 0;
 }
 
 TSharedRef<IHttpRequest> UPulseDownloadChunk::MakeDownloadRequest(const FString& URL, FInt64Vector2 DownloadRange)
@@ -2,7 +2,9 @@
 
 
 #include "DownloadManager/PulseDownloadTask.h"
+#include "PulseGameFramework.h"
 #include "Algo/Sort.h"
+#include "Async/Async.h"
 #include "Core/PulseSystemLibrary.h"
 
 
@@ -16,6 +18,12 @@ bool UPulseDownloadTask::IsComplete() const
 	for (const UPulseDownloadChunk* Chunk : Chunks)
 		if (!Chunk || !Chunk->IsCompleted())
 			return false;
+	if (IsAdaptive())
+	{
+		TArray<FInt64Vector2> ranges;
+		GetUncoveredRanges(ranges);
+		return ranges.IsEmpty();
+	}
 	return true;
 }
 
@@ -24,7 +32,7 @@ int64 UPulseDownloadTask::GetTotalSize() const
 	return IsInitialized() ? TotalSize : Identifier.SavedTotalSize;
 }
 
-int32 UPulseDownloadTask::GenerateChunks(const int64 ChunkSize)
+int32 UPulseDownloadTask::GenerateChunks(const int64 ChunkSize, const int32 BufferSize)
 {
 	for (int i = 0; i < Chunks.Num(); ++i)
 		if (Chunks[i] && Chunks[i]->IsActive())
@@ -35,29 +43,31 @@ int32 UPulseDownloadTask::GenerateChunks(const int64 ChunkSize)
 
 	// Get chunks from disk
 	TArray<FString> ChunkPaths;
-	FString fileName;
-	FString extension;
-	Identifier.FileName.Split(TEXT("."), &fileName, &extension, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
-	FString Path = FPaths::ProjectPersistentDownloadDir() + "/DownloadChunks/" + Identifier.Id.ToString();
-	UPulseSystemLibrary::FileGetAllFilesInDirectory(Path, ChunkPaths, false, "");
+	WriteBufferSize = BufferSize;
+	UPulseSystemLibrary::FileGetAllFilesInDirectory(GetChunkDirectory(), ChunkPaths, false, "");
 
 	// Add Chunks
-	int32 ChunkNum = FMath::CeilToInt((double)TotalSize / ChunkSize);
-	for (int i = 0; i < ChunkNum; i++)
+	if (IsAdaptive())
 	{
-		auto range = FInt64Vector2(ChunkSize * i, FMath::Min(ChunkSize * (i + 1), TotalSize) - 1);
-		UPulseDownloadChunk* newChunk = NewObject<UPulseDownloadChunk>();
-		newChunk->InitializeChunk(Path + "/" + Identifier.FileName, i, range.X, range.Y);
-		const int32 pathIndex = ChunkPaths.IndexOfByKey(newChunk->ChunkPath);
-		if (pathIndex != INDEX_NONE)
+		GenerateAdaptiveChunks_Internal(ChunkPaths);
+	}
+	else
+	{
+		int32 ChunkNum = FMath::CeilToInt((double)TotalSize / ChunkSize);
+		for (int i = 0; i < ChunkNum; i++)
 		{
-			const auto size = newChunk->GetLocalSize();
-			if (size <= newChunk->GetTargetSize())
+			UPulseDownloadChunk* newChunk = MakeChunk_Internal(i, ChunkSize * i, FMath::Min(ChunkSize * (i + 1), TotalSize) - 1);
+			const int32 pathIndex = ChunkPaths.IndexOfByKey(newChunk->ChunkPath);
+			if (pathIndex != INDEX_NONE)
 			{
-				ChunkPaths.RemoveAt(pathIndex);
+				const auto size = newChunk->GetLocalSize();
+				if (size <= newChunk->GetTargetSize())
+				{
+					ChunkPaths.RemoveAt(pathIndex);
+				}
 			}
+			AddChunk(newChunk);
 		}
-		AddChunk(newChunk);
 	}
 
 	// Remove obsolete chunks
@@ -65,37 +75,173 @@ int32 UPulseDownloadTask::GenerateChunks(const int64 ChunkSize)
 	{
 		UPulseSystemLibrary::FileDelete(ChunkPaths[i]);
 	}
+	if (IsAdaptive())
+	{
+		// The ranges left are chunks yet to be cut.
+		TArray<FInt64Vector2> ranges;
+		GetUncoveredRanges(ranges);
+		return Chunks.Num() + ranges.Num();
+	}
 	return Chunks.Num();
 }
 
-void UPulseDownloadTask::StartChunksDownload(int32 MaxParallelChunks, const float TimeOut)
+bool UPulseDownloadTask::IsAdaptive() const
 {
-	ParallelChunkCount = FMath::Max(MaxParallelChunks, 1);
-	int32 count = 0;
-	int32 completed = 0;
-	for (int i = 0; i < Chunks.Num(); ++i)
+	return Identifier.bAdaptiveChunks && bDoServerSupportRange;
+}
+
+FString UPulseDownloadTask::GetChunkDirectory() const
+{
+	return FPaths::ProjectPersistentDownloadDir() + "/DownloadChunks/" + Identifier.Id.ToString();
+}
+
+void UPulseDownloadTask::GetUncoveredRanges(TArray<FInt64Vector2>& OutRanges) const
+{
+	OutRanges.Empty();
+	TArray<FInt64Vector2> covered;
+	for (const UPulseDownloadChunk* Chunk : Chunks)
 	{
-		if (!Chunks[i])
+		if (Chunk)
+			covered.Add(FInt64Vector2(Chunk->FileStartByte, Chunk->FileEndByte));
+	}
+	covered.Sort([](const FInt64Vector2& A, const FInt64Vector2& B) { return A.X < B.X; });
+	int64 cursor = 0;
+	for (const auto& range : covered)
+	{
+		if (range.X > cursor)
+			OutRanges.Add(FInt64Vector2(cursor, range.X - 1));
+		cursor = FMath::Max(cursor, range.Y + 1);
+	}
+	if (cursor < TotalSize)
+		OutRanges.Add(FInt64Vector2(cursor, TotalSize - 1));
+}
+
+UPulseDownloadChunk* UPulseDownloadTask::CarveChunk()
+{
+	if (!IsAdaptive())
+		return nullptr;
+	TArray<FInt64Vector2> ranges;
+	GetUncoveredRanges(ranges);
+	if (ranges.IsEmpty())
+		return nullptr;
+	// Ranges start on the alignment, so chunk leaves hash the same as the whole file's.
+	const int64 from = ranges[0].X;
+	const int64 to = FMath::Min(ranges[0].Y, from + ChunkSizer.GetChunkSize() - 1);
+	UPulseDownloadChunk* newChunk = MakeChunk_Internal(from / ChunkSizer.GetAlignment(), from, to);
+	AddChunk(newChunk);
+	return newChunk;
+}
+
+UPulseDownloadChunk* UPulseDownloadTask::MakeChunk_Internal(int32 ChunkIdx, int64 From, int64 To) const
+{
+	UPulseDownloadChunk* newChunk = NewObject<UPulseDownloadChunk>();
+	newChunk->InitializeChunk(GetChunkDirectory() + "/" + Identifier.FileName, ChunkIdx, From, To);
+	newChunk->WriteBufferSize = WriteBufferSize;
+	newChunk->HashType = Identifier.HashType;
+	return newChunk;
+}
+
+void UPulseDownloadTask::GenerateAdaptiveChunks_Internal(TArray<FString>& ChunkPaths)
+{
+	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+	const int64 alignment = ChunkSizer.GetAlignment();
+	TArray<FInt64Vector2> files;
+	for (const FString& chunkPath : ChunkPaths)
+	{
+		FString path;
+		FString indexStr;
+		if (!chunkPath.Split(TEXT("_"), &path, &indexStr, ESearchCase::IgnoreCase, ESearchDir::FromEnd) || !indexStr.IsNumeric())
 			continue;
-		if (Chunks[i]->IsCompleted())
-		{
-			completed++;
+		const int64 start = FCString::Atoi64(*indexStr) * alignment;
+		const int64 size = PF.FileSize(*chunkPath);
+		if (size <= 0 || start >= TotalSize)
 			continue;
-		}
-		if (Chunks[i]->IsActive())
-		{
-			count++;
+		files.Add(FInt64Vector2(start, size));
+	}
+	files.Sort([](const FInt64Vector2& A, const FInt64Vector2& B) { return A.X < B.X; });
+	for (int i = 0; i < files.Num(); i++)
+	{
+		// A chunk ends with its data on the next alignment, or where the next chunk starts.
+		const int64 next = files.IsValidIndex(i + 1) ? files[i + 1].X : TotalSize;
+		const int64 dataEnd = files[i].X + files[i].Y;
+		if (dataEnd > next)
 			continue;
-		}
-		if (count >= ParallelChunkCount)
-			break;
-		if (Chunks[i]->StartChunk(Identifier.Url))
+		const int64 end = FMath::Min(FMath::DivideAndRoundUp(dataEnd, alignment) * alignment, next) - 1;
+		UPulseDownloadChunk* newChunk = MakeChunk_Internal(files[i].X / alignment, files[i].X, end);
+		const int32 pathIndex = ChunkPaths.IndexOfByKey(newChunk->ChunkPath);
+		if (pathIndex == INDEX_NONE)
+			continue;
+		ChunkPaths.RemoveAt(pathIndex);
+		AddChunk(newChunk);
+	}
+}
+
+bool UPulseDownloadTask::HasExhaustedChunk_Internal() const
+{
+	for (const UPulseDownloadChunk* Chunk : Chunks)
+	{
+		if (Chunk && Chunk->FailCount > MaxChunkRetries)
+			return true;
+	}
+	return false;
+}
+
+bool UPulseDownloadTask::HasPendingChunks() const
+{
+	for (const UPulseDownloadChunk* Chunk : Chunks)
+	{
+		if (Chunk && !Chunk->IsActive() && Chunk->FailCount <= MaxChunkRetries && !Chunk->IsCompleted())
+			return true;
+	}
+	// No need to cut more chunks once the task can't complete.
+	if (IsAdaptive() && !HasExhaustedChunk_Internal())
+	{
+		TArray<FInt64Vector2> ranges;
+		GetUncoveredRanges(ranges);
+		return !ranges.IsEmpty();
+	}
+	return false;
+}
+
+int32 UPulseDownloadTask::GetActiveChunkCount() const
+{
+	int32 count = 0;
+	for (const UPulseDownloadChunk* Chunk : Chunks)
+	{
+		if (Chunk && Chunk->IsActive())
 			count++;
 	}
-	if (completed > 0)
+	return count;
+}
+
+bool UPulseDownloadTask::StartNextChunk()
+{
+	for (UPulseDownloadChunk* Chunk : Chunks)
+	{
+		if (!Chunk || Chunk->IsActive() || Chunk->FailCount > MaxChunkRetries)
+			continue;
+		if (Chunk->StartChunk(Identifier.Url))
+			return true;
+	}
+	if (IsAdaptive() && !HasExhaustedChunk_Internal())
+	{
+		UPulseDownloadChunk* newChunk = CarveChunk();
+		return newChunk && newChunk->StartChunk(Identifier.Url);
+	}
+	return false;
+}
+
+int64 UPulseDownloadTask::ConsumeReceivedBytes()
+{
+	int64 bytes = 0;
+	for (UPulseDownloadChunk* Chunk : Chunks)
 	{
-		OnTaskUpdate.Broadcast(this);
+		if (!Chunk)
+			continue;
+		bytes += Chunk->UnsampledBytes;
+		Chunk->UnsampledBytes = 0;
 	}
+	return bytes;
 }
 
 int64 UPulseDownloadTask::GetDownloadedSize()
@@ -151,6 +297,9 @@ bool UPulseDownloadTask::StopChunk(UPulseDownloadChunk* Chunk)
 
 bool UPulseDownloadTask::PauseTask()
 {
+	// The merge only reads what's already on disk, it runs to its end.
+	if (IsMerging())
+		return false;
 	int32 Count = 0;
 	for (int i = 0; i < Chunks.Num(); ++i)
 	{
@@ -168,6 +317,8 @@ bool UPulseDownloadTask::PauseTask()
 
 void UPulseDownloadTask::EmergencyHaltTask()
 {
+	CancelMerge();
+	MergeState.Reset();
 	for (int i = Chunks.Num() - 1; i >= 0; i--)
 	{
 		if (Chunks[i] && Chunks[i]->Request.IsValid())
@@ -177,6 +328,8 @@ void UPulseDownloadTask::EmergencyHaltTask()
 			Chunks[i]->Request->CancelRequest();
 			Chunks[i]->Request.Reset();
 		}
+		if (Chunks[i])
+			Chunks[i]->ReleaseChunkFile();
 		RemoveChunk(i);
 	}
 	Chunks.Empty();
@@ -184,6 +337,12 @@ void UPulseDownloadTask::EmergencyHaltTask()
 
 bool UPulseDownloadTask::CancelTask()
 {
+	if (IsMerging())
+	{
+		CancelMerge();
+		bIsActionRequestOngoing = true;
+		return true;
+	}
 	int32 Count = 0;
 	for (int i = 0; i < Chunks.Num(); ++i)
 	{
@@ -246,62 +405,234 @@ void UPulseDownloadTask::DeleteChunkFiles()
 		RemoveChunk(i, true);
 }
 
-void UPulseDownloadTask::OnChunkCompleted(UPulseDownloadChunk* Chunk)
+bool UPulseDownloadTask::IsMerging() const
 {
-	const int32 chunkIndex = Chunks.IndexOfByKey(Chunk);
-	if (chunkIndex == INDEX_NONE)
-		return;
-	int32 count = 0;
-	for (int i = 0; i < Chunks.Num(); ++i)
+	return MergeState.IsValid();
+}
+
+float UPulseDownloadTask::GetMergeProgress() const
+{
+	if (!MergeState.IsValid() || MergeState->TotalSize <= 0)
+		return 0;
+	return static_cast<float>(static_cast<double>(MergeState->MergedSize.load()) / MergeState->TotalSize);
+}
+
+bool UPulseDownloadTask::MergeChunks()
+{
+	if (IsMerging())
+		return false;
+	Algo::Sort(Chunks, [](const TObjectPtr<UPulseDownloadChunk>& Chunk1, const TObjectPtr<UPulseDownloadChunk>& Chunk2)
 	{
-		if (!Chunks[i])
+		return Chunk1 && Chunk2 && Chunk1->GetChunkIndex() < Chunk2->GetChunkIndex();
+	});
+	MergeState = MakeShared<FPulseChunkMergeState>();
+	MergeState->TotalSize = GetTotalSize();
+	MergeState->HashType = Identifier.HashType;
+	MergeState->ExpectedHash = Identifier.ExpectedHash;
+	TArray<FString> chunkPaths;
+	bool bAllLeavesKnown = true;
+	for (const auto& chunk : Chunks)
+	{
+		if (!chunk)
 			continue;
-		if (Chunks[i]->IsCompleted() && !Chunks[i]->IsActive())
-			count++;
+		chunkPaths.Add(chunk->ChunkPath);
+		MergeState->ChunkLeaves.Add(chunk->LeafDigests);
+		bAllLeavesKnown &= !chunk->LeafDigests.IsEmpty();
 	}
-	if (count < Chunks.Num())
+	if (chunkPaths.IsEmpty())
 	{
-		StartChunksDownload(ParallelChunkCount);
-		return;
+		MergeState.Reset();
+		OnTaskCompleted.Broadcast(this);
+		return true;
 	}
-	bIsActionRequestOngoing = false;
-	//Write chunks to whole file
-	Algo::Sort(Chunks, [](const TObjectPtr<UPulseDownloadChunk>& Chunk1, const TObjectPtr<UPulseDownloadChunk>& Chunk2)
+	if (MergeState->HashType != EPulseDownloadHash::None && bAllLeavesKnown)
 	{
-		return Chunk1 && Chunk2 && Chunk1->GetChunkIndex() < Chunk2->GetChunkIndex();
+		// Hashed as written, the file is verified the moment its last byte lands. A corrupt file is never merged.
+		MergeState->FileHash = MergeState->DigestChunkLeaves();
+		if (!MergeState->MatchExpectedHash())
+		{
+			MergeState->bHashMismatch = true;
+			OnChunksMerged(MergeState, false);
+			return false;
+		}
+	}
+	const TSharedPtr<FPulseChunkMergeState> state = MergeState;
+	const FString filePath = Identifier.GetFilePath();
+	const int32 bufferSize = WriteBufferSize;
+	TWeakObjectPtr<UPulseDownloadTask> weakTask = this;
+	Async(EAsyncExecution::ThreadPool, [chunkPaths, filePath, bufferSize, state, weakTask]()
+	{
+		const bool bSuccess = MergeChunkFiles(chunkPaths, filePath, bufferSize, *state, [weakTask]()-> void
+		{
+			AsyncTask(ENamedThreads::GameThread, [weakTask]()-> void
+			{
+				if (weakTask.IsValid())
+					weakTask->OnTaskUpdate.Broadcast(weakTask.Get());
+			});
+		});
+		// Back to game thread
+		AsyncTask(ENamedThreads::GameThread, [weakTask, state, bSuccess]()-> void
+		{
+			if (weakTask.IsValid())
+				weakTask->OnChunksMerged(state, bSuccess);
+		});
 	});
-	if (Chunks.Num() > 0)
+	return true;
+}
+
+void UPulseDownloadTask::CancelMerge()
+{
+	if (MergeState.IsValid())
+		MergeState->bCancelled = true;
+}
+
+void UPulseDownloadTask::OnChunksMerged(const TSharedPtr<FPulseChunkMergeState>& State, bool bSuccess)
+{
+	// Halted, or not the current merge anymore.
+	if (!State.IsValid() || MergeState != State)
+		return;
+	MergeState.Reset();
+	bIsActionRequestOngoing = false;
+	if (bSuccess)
 	{
-		TUniquePtr<IFileHandle> FileHandle;
-		TArray<uint8> ChunkData;
-		IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
-		// Trying to delete the file is it already exist
-		PF.DeleteFile(*Identifier.GetFilePath());
-		FileHandle.Reset(PF.OpenWrite(*Identifier.GetFilePath(), true));
-		for (int i = 0; i < Chunks.Num(); ++i)
+		Identifier.FileHash = State->FileHash;
+		// Delete chunks
+		DeleteChunkFiles();
+		// Reset
+		Chunks.Empty();
+		OnTaskCompleted.Broadcast(this);
+		return;
+	}
+	if (DownloadState == EPulseDownloadState::Cancelled)
+	{
+		OnTaskCancelled.Broadcast(this);
+		return;
+	}
+	if (State->bHashMismatch)
+	{
+		UE_LOG(LogPulseDownloader, Error, TEXT("Download verification failed: hash %s, expected %s (Task:%s)"), *State->FileHash, *State->ExpectedHash,
+		       *Identifier.ToString());
+		OnTaskFailed.Broadcast(this);
+		return;
+	}
+	UE_LOG(LogPulseDownloader, Error, TEXT("Failed to merge chunks: %s/%s merged (Task:%s)"), *UPulseSystemLibrary::FileSizeToString(State->MergedSize.load()),
+	       *UPulseSystemLibrary::FileSizeToString(State->TotalSize), *Identifier.ToString());
+	OnTaskFailed.Broadcast(this);
+}
+
+bool UPulseDownloadTask::MergeChunkFiles(const TArray<FString>& ChunkPaths, const FString& FilePath, int32 BufferSize, FPulseChunkMergeState& State,
+                                         const TFunction<void()>& OnProgress)
+{
+	if (ChunkPaths.IsEmpty())
+		return false;
+	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+	const FString& basePath = ChunkPaths[0];
+	const int64 baseSize = PF.FileSize(*basePath);
+	if (baseSize < 0)
+		return false;
+	// Chunks completed in an earlier session have no leaves yet, they are hashed as they are read.
+	const bool bHashChunks = State.HashType != EPulseDownloadHash::None && State.FileHash.IsEmpty();
+	State.ChunkLeaves.SetNum(ChunkPaths.Num());
+	State.MergedSize = baseSize;
+	bool bSuccess = true;
+	{
+		// The first chunk is grown in place, it's only read back if it must be hashed.
+		TUniquePtr<IFileHandle> baseHandle(PF.OpenWrite(*basePath, true, true));
+		if (!baseHandle.IsValid())
+			return false;
+		TArray<uint8> buffer;
+		buffer.SetNumUninitialized(FMath::Max(BufferSize, 4096));
+		if (bHashChunks && State.ChunkLeaves[0].IsEmpty())
 		{
-			if (!Chunks[i])
-				continue;
-			ChunkData.Empty();
-			if (!FFileHelper::LoadFileToArray(ChunkData, *Chunks[i]->ChunkPath))
-				break;
-			if (FileHandle.IsValid())
+			FPulseTreeHasher hasher(State.HashType);
+			baseHandle->Seek(0);
+			for (int64 remaining = baseSize; remaining > 0 && bSuccess;)
+			{
+				const int64 readSize = FMath::Min<int64>(buffer.Num(), remaining);
+				bSuccess = !State.bCancelled && baseHandle->Read(buffer.GetData(), readSize);
+				hasher.Update(buffer.GetData(), readSize);
+				remaining -= readSize;
+			}
+			baseHandle->SeekFromEnd(0);
+			State.ChunkLeaves[0] = hasher.Finish();
+		}
+		const int64 reportStep = FMath::Max<int64>(State.TotalSize / 100, buffer.Num());
+		int64 lastReported = baseSize;
+		for (int32 i = 1; i < ChunkPaths.Num() && bSuccess; i++)
+		{
+			TUniquePtr<IFileHandle> readHandle(PF.OpenRead(*ChunkPaths[i]));
+			if (!readHandle.IsValid())
 			{
-				FileHandle->Write(ChunkData.GetData(), ChunkData.Num());
+				bSuccess = false;
+				break;
 			}
-			else if (Chunks[i]->GetChunkIndex() == 0)
+			FPulseTreeHasher hasher(bHashChunks && State.ChunkLeaves[i].IsEmpty() ? State.HashType : EPulseDownloadHash::None);
+			int64 remaining = readHandle->Size();
+			while (remaining > 0)
 			{
-				FFileHelper::SaveArrayToFile(ChunkData, *Identifier.GetFilePath());
-				FileHandle.Reset(PF.OpenWrite(*Identifier.GetFilePath(), true));
+				const int64 readSize = FMath::Min<int64>(buffer.Num(), remaining);
+				if (State.bCancelled || !readHandle->Read(buffer.GetData(), readSize) || !baseHandle->Write(buffer.GetData(), readSize))
+				{
+					bSuccess = false;
+					break;
+				}
+				hasher.Update(buffer.GetData(), readSize);
+				remaining -= readSize;
+				State.MergedSize += readSize;
+				if (State.MergedSize - lastReported >= reportStep)
+				{
+					lastReported = State.MergedSize;
+					OnProgress();
+				}
 			}
+			if (hasher.IsEnabled())
+				State.ChunkLeaves[i] = hasher.Finish();
 		}
-		FileHandle.Reset();
-		// Delete chunks
-		DeleteChunkFiles();
-		// Reset
-		Chunks.Empty();
+		if (bSuccess && bHashChunks)
+		{
+			State.FileHash = State.DigestChunkLeaves();
+			State.bHashMismatch = !State.MatchExpectedHash();
+			bSuccess = !State.bHashMismatch;
+		}
+		// Roll the first chunk back, an interrupted merge must not cost its download.
+		if (!bSuccess)
+			baseHandle->Truncate(baseSize);
 	}
-	OnTaskCompleted.Broadcast(this);
+	if (!bSuccess)
+		return false;
+	// Across volumes, the move falls back to a copy.
+	if (IFileManager::Get().Move(*FilePath, *basePath, true))
+		return true;
+	TUniquePtr<IFileHandle> rollbackHandle(PF.OpenWrite(*basePath, true));
+	if (rollbackHandle.IsValid())
+		rollbackHandle->Truncate(baseSize);
+	return false;
+}
+
+void UPulseDownloadTask::OnChunkCompleted(UPulseDownloadChunk* Chunk)
+{
+	const int32 chunkIndex = Chunks.IndexOfByKey(Chunk);
+	if (chunkIndex == INDEX_NONE)
+		return;
+	if (IsMerging())
+		return;
+	if (IsAdaptive())
+		ChunkSizer.AddSample(Chunk->LastRequestBytes, Chunk->LastRequestSeconds, Chunk->LastRequestLatency);
+	if (IsComplete())
+	{
+		bIsActionRequestOngoing = false;
+		// Write chunks to whole file, off the game thread
+		MergeChunks();
+		return;
+	}
+	if (DownloadState == EPulseDownloadState::Downloading && (HasPendingChunks() || GetActiveChunkCount() > 0))
+	{
+		OnTaskSlotReleased.Broadcast(this);
+		return;
+	}
+	if (GetActiveChunkCount() > 0)
+		return;
+	EndTask_Internal();
 }
 
 void UPulseDownloadTask::OnChunkUpdated(UPulseDownloadChunk* Chunk)
@@ -314,16 +645,28 @@ void UPulseDownloadTask::OnChunkFailed(UPulseDownloadChunk* Chunk)
 	const int32 chunkIndex = Chunks.IndexOfByKey(Chunk);
 	if (chunkIndex == INDEX_NONE)
 		return;
-	int32 count = 0;
-	for (int i = 0; i < Chunks.Num(); ++i)
+	if (IsAdaptive() && DownloadState == EPulseDownloadState::Downloading)
 	{
-		if (!Chunks[i])
-			continue;
-		if (!Chunks[i]->IsActive())
-			count++;
+		// Only retry a chunk of the measured size, the rest of the failed chunk goes back to the ranges to cut.
+		const int64 alignment = ChunkSizer.GetAlignment();
+		const int64 from = Chunk->FileStartByte + FMath::Max(Chunk->GetLocalSize(), 0);
+		const int64 end = FMath::DivideAndRoundUp(from + ChunkSizer.GetChunkSize(), alignment) * alignment - 1;
+		if (end < Chunk->FileEndByte)
+			Chunk->FileEndByte = end;
 	}
-	if (count < Chunks.Num())
+	// The failed chunk is retried by the scheduler, when a connection is free.
+	if (DownloadState == EPulseDownloadState::Downloading && (HasPendingChunks() || GetActiveChunkCount() > 0))
+	{
+		OnTaskSlotReleased.Broadcast(this);
 		return;
+	}
+	if (GetActiveChunkCount() > 0)
+		return;
+	EndTask_Internal();
+}
+
+void UPulseDownloadTask::EndTask_Internal()
+{
 	bIsActionRequestOngoing = false;
 	switch (DownloadState)
 	{
@@ -0,0 +1,194 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+
+#include "DownloadManager/PulseDownloadTypes.h"
+#include "HAL/PlatformFileManager.h"
+
+
+FPulseTreeHasher::FPulseTreeHasher(EPulseDownloadHash HashType)
+	: _type(HashType)
+{
+}
+
+void FPulseTreeHasher::Update(const uint8* Data, int64 Length)
+{
+	if (!IsEnabled())
+		return;
+	while (Length > 0)
+	{
+		const int64 size = FMath::Min(Length, LeafSize - _leafFill);
+		if (_type == EPulseDownloadHash::MD5)
+			_md5.Update(Data, size);
+		else
+			_xxHash.Update(Data, size);
+		Data += size;
+		Length -= size;
+		_leafFill += size;
+		_hashedSize += size;
+		if (_leafFill >= LeafSize)
+			CloseLeaf_Internal();
+	}
+}
+
+const TArray<uint8>& FPulseTreeHasher::Finish()
+{
+	if (_leafFill > 0)
+		CloseLeaf_Internal();
+	return _leafDigests;
+}
+
+int32 FPulseTreeHasher::GetDigestSize(EPulseDownloadHash HashType)
+{
+	switch (HashType)
+	{
+	case EPulseDownloadHash::MD5:
+		return 16;
+	case EPulseDownloadHash::XxHash64:
+		return 8;
+	default:
+		return 0;
+	}
+}
+
+FString FPulseTreeHasher::DigestLeaves(EPulseDownloadHash HashType, const TArray<uint8>& LeafDigests)
+{
+	switch (HashType)
+	{
+	case EPulseDownloadHash::MD5:
+		{
+			FMD5 md5;
+			md5.Update(LeafDigests.GetData(), LeafDigests.Num());
+			uint8 digest[16];
+			md5.Final(digest);
+			return BytesToHex(digest, 16).ToLower();
+		}
+	case EPulseDownloadHash::XxHash64:
+		return FString::Printf(TEXT("%016llx"), FXxHash64::HashBuffer(LeafDigests.GetData(), LeafDigests.Num()).Hash);
+	default:
+		return "";
+	}
+}
+
+FString FPulseTreeHasher::HashFile(const FString& FilePath, EPulseDownloadHash HashType, int32 BufferSize)
+{
+	if (HashType == EPulseDownloadHash::None)
+		return "";
+	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IFileHandle> handle(PF.OpenRead(*FilePath));
+	if (!handle.IsValid())
+		return "";
+	FPulseTreeHasher hasher(HashType);
+	TArray<uint8> buffer;
+	buffer.SetNumUninitialized(FMath::Max(BufferSize, 4096));
+	int64 remaining = handle->Size();
+	while (remaining > 0)
+	{
+		const int64 readSize = FMath::Min<int64>(buffer.Num(), remaining);
+		if (!handle->Read(buffer.GetData(), readSize))
+			return "";
+		hasher.Update(buffer.GetData(), readSize);
+		remaining -= readSize;
+	}
+	return DigestLeaves(HashType, hasher.Finish());
+}
+
+void FPulseTreeHasher::CloseLeaf_Internal()
+{
+	if (_type == EPulseDownloadHash::MD5)
+	{
+		uint8 digest[16];
+		_md5.Final(digest);
+		_leafDigests.Append(digest, 16);
+		_md5 = FMD5();
+	}
+	else
+	{
+		// Big endian, for the digest not to depend on the platform.
+		const uint64 hash = _xxHash.Finalize().Hash;
+		for (int32 i = 7; i >= 0; i--)
+			_leafDigests.Add(static_cast<uint8>(hash >> (i * 8)));
+		_xxHash.Reset();
+	}
+	_leafFill = 0;
+}
+
+
+void FPulseConnectionTuner::Initialize(int32 MinConnections, int32 MaxConnections, double WindowSeconds)
+{
+	_minConnections = FMath::Max(MinConnections, 1);
+	_maxConnections = FMath::Max(MaxConnections, _minConnections);
+	_connections = (_minConnections + _maxConnections) / 2;
+	_direction = 1;
+	_windowSeconds = FMath::Max(WindowSeconds, 0.1);
+	_windowStart = -1;
+	_lastThroughput = -1;
+	_windowBytes = 0;
+}
+
+bool FPulseConnectionTuner::AddSample(int64 Bytes, double Now)
+{
+	if (_windowStart < 0)
+		_windowStart = Now;
+	_windowBytes += FMath::Max<int64>(Bytes, 0);
+	const double elapsed = Now - _windowStart;
+	if (elapsed < _windowSeconds)
+		return false;
+	const double throughput = _windowBytes / elapsed;
+	_windowStart = Now;
+	_windowBytes = 0;
+	if (_lastThroughput > 0)
+	{
+		const double gain = throughput / _lastThroughput - 1;
+		// The last step cost throughput, step back.
+		if (gain < -0.05)
+			_direction = -_direction;
+		// No gain, the same throughput is kept with fewer connections.
+		else if (gain < 0.05)
+			_direction = -1;
+	}
+	_lastThroughput = throughput;
+	const int32 previous = _connections;
+	_connections = FMath::Clamp(_connections + _direction, _minConnections, _maxConnections);
+	return _connections != previous;
+}
+
+
+void FPulseChunkSizer::Initialize(int64 MinChunkSize, int64 MaxChunkSize, double TargetSeconds, int64 MaxRetryCost, int64 Alignment)
+{
+	_alignment = FMath::Max<int64>(Alignment, 1);
+	_minChunkSize = FMath::Max(MinChunkSize, _alignment);
+	_maxChunkSize = FMath::Max(MaxChunkSize, _minChunkSize);
+	_maxRetryCost = FMath::Max(MaxRetryCost, _minChunkSize);
+	_targetSeconds = FMath::Max(TargetSeconds, 0.1);
+	_throughput = 0;
+	_latency = 0;
+	_sampleCount = 0;
+}
+
+void FPulseChunkSizer::AddSample(int64 Bytes, double Seconds, double LatencySeconds)
+{
+	if (Bytes <= 0 || Seconds <= 0)
+		return;
+	// Progress is only seen once per frame, a fast request can look like it was all latency.
+	const double latency = FMath::Clamp(LatencySeconds, 0.0, Seconds * 0.5);
+	// The transfer rate, without the time waiting for the first byte.
+	const double throughput = Bytes / FMath::Max(Seconds - latency, 0.001);
+	// The first samples weigh more, the size leaves the small start quickly.
+	const double weight = FMath::Max(1.0 / (_sampleCount + 1), 0.3);
+	_throughput = FMath::Lerp(_throughput, throughput, weight);
+	_latency = FMath::Lerp(_latency, latency, weight);
+	_sampleCount++;
+}
+
+int64 FPulseChunkSizer::GetChunkSize() const
+{
+	if (_sampleCount <= 0)
+		return _minChunkSize;
+	// Long enough for the latency to stay a small part of the request, even above the target duration.
+	const double seconds = FMath::Max(_targetSeconds, _latency * 4);
+	double size = _throughput * seconds;
+	size = FMath::Min(size, static_cast<double>(_maxRetryCost));
+	size = FMath::Clamp(size, static_cast<double>(_minChunkSize), static_cast<double>(_maxChunkSize));
+	const int64 aligned = static_cast<int64>(size) / _alignment * _alignment;
+	return FMath::Max(aligned, _alignment);
+}
@@ -8,6 +8,8 @@
 #include "HttpModule.h"
 #include "PulseGameFramework.h"
 #include "Algo/Count.h"
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
 #include "Core/PulseSystemLibrary.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Kismet/GameplayStatics.h"
@@ -30,14 +32,7 @@ bool UPulseDownloader::StartDownload_Internal(const FDownloadIdentifier& Downloa
 
 bool UPulseDownloader::RequestDownloadStart(const FGuid& DownloadId)
 {
-	int32 downloadingCount = 0;
-	for (const auto& pair : Downloads)
-	{
-		if (!pair.Value)
-			continue;
-		if (pair.Value->DownloadState == EPulseDownloadState::Downloading)
-			downloadingCount++;
-	}
+	const int32 downloadingCount = GetActiveDownloadCount();
 	if (downloadingCount >= _maxConcurrentDownloads)
 	{
 		UE_LOG(LogPulseDownloader, Error, TEXT("Start Request Failed: Too many active downloads (%d) (ID:%s)"), downloadingCount, *DownloadId.ToString());
@@ -220,7 +215,9 @@ void UPulseDownloader::DownloadTask(const FGuid& DownloadId, int32 MBChunkSize)
 				return;
 			}
 			const int64 byteChunkSize = MBChunkSize > 0 ? MBChunkSize * 1048576 : 1048576; // 1048576 bytes = 1 MB as default chunk size.
-			const int32 chunkCount = Task->GenerateChunks(byteChunkSize);
+			Task->ChunkSizer.Initialize(static_cast<int64>(dm->_minDownloadChunkMBSize) * 1048576, byteChunkSize, dm->_targetChunkSeconds,
+			                            static_cast<int64>(dm->_maxChunkRetryMBCost) * 1048576);
+			const int32 chunkCount = Task->GenerateChunks(byteChunkSize, FMath::Max(dm->_downloadWriteBufferKBSize, 4) * 1024);
 			if (chunkCount <= 0)
 			{
 				UE_LOG(LogPulseDownloader, Error, TEXT("Failed to Chunk download: No chunk had been generated (Task:%s)"), *Task->Identifier.ToString());
@@ -228,11 +225,67 @@ void UPulseDownloader::DownloadTask(const FGuid& DownloadId, int32 MBChunkSize)
 				return;
 			}
 			dm->BindDownloadTask(Task);
-			Task->StartChunksDownload(dm->_maxConcurrentChunks, dm->_fileInfosQueryTimeOutSeconds);
+			Task->ParallelChunkCount = FMath::Max(dm->_maxConcurrentChunks, 1);
+			Task->MaxChunkRetries = FMath::Max(dm->_downloadChunkRetries, 0);
 			UE_LOG(LogPulseDownloader, Log, TEXT("Starting to download Task %s"), *Task->Identifier.ToString());
+			if (Task->IsComplete())
+			{
+				// Every chunk is already on disk.
+				Task->MergeChunks();
+				return;
+			}
+			dm->ScheduleChunks();
 		});
 }
 
+void UPulseDownloader::ScheduleChunks()
+{
+	TArray<UPulseDownloadTask*> pendingTasks;
+	int32 activeCount = 0;
+	for (const auto& pair : Downloads)
+	{
+		if (!pair.Value || pair.Value->DownloadState != EPulseDownloadState::Downloading)
+			continue;
+		activeCount += pair.Value->GetActiveChunkCount();
+		if (pair.Value->HasPendingChunks())
+			pendingTasks.Add(pair.Value);
+	}
+	// Foreground first, then the oldest.
+	Algo::Sort(pendingTasks, [](const UPulseDownloadTask* A, const UPulseDownloadTask* B)
+	{
+		if (A->Identifier.Priority != B->Identifier.Priority)
+			return A->Identifier.Priority > B->Identifier.Priority;
+		return A->Identifier.StartDate < B->Identifier.StartDate;
+	});
+	const int32 budget = GetDownloadConnectionCount();
+	bool bTaskDrained = false;
+	for (UPulseDownloadTask* task : pendingTasks)
+	{
+		if (activeCount >= budget)
+			break;
+		while (activeCount < budget && task->GetActiveChunkCount() < task->ParallelChunkCount && task->StartNextChunk())
+			activeCount++;
+		bTaskDrained |= !task->HasPendingChunks();
+	}
+	// A task with only in-flight chunks left frees its download slot, a queued download can take over its connections.
+	if (bTaskDrained && GetActiveDownloadCount() < _maxConcurrentDownloads)
+		StartQueueDownload();
+}
+
+int32 UPulseDownloader::GetActiveDownloadCount() const
+{
+	int32 count = 0;
+	for (const auto& pair : Downloads)
+	{
+		if (!pair.Value || pair.Value->DownloadState != EPulseDownloadState::Downloading)
+			continue;
+		// Not chunked yet, or with chunks to start.
+		if (pair.Value->Chunks.IsEmpty() || pair.Value->HasPendingChunks())
+			count++;
+	}
+	return count;
+}
+
 void UPulseDownloader::BroadcastDownloadEvent(const FGuid& DownloadId, EPulseDownloadState EventType)
 {
 	AsyncTask(ENamedThreads::GameThread, [DownloadId, EventType]()-> void
@@ -320,10 +373,12 @@ void UPulseDownloader::OnReceiveDownloadInfos(const FGuid& DownloadId, FString F
 		DownloadManager->BroadcastDownloadEvent(DownloadId, EPulseDownloadState::Failed);
 		return;
 	}
-	if (FileSize >= (DownloadManager->_downloadChunkMBSize * 1024 * 1024))
+	// Adaptive chunks start small, any file larger than the first chunk can use ranges.
+	const int32 rangeThresholdMb = DownloadTask->Identifier.bAdaptiveChunks ? DownloadManager->_minDownloadChunkMBSize : DownloadManager->_downloadChunkMBSize;
+	if (FileSize >= (rangeThresholdMb * 1024 * 1024))
 	{
 		UE_LOG(LogPulseDownloader, Warning, TEXT("Query Download Infos: File Size (%s) is larger than a chunk(%s). Verifying Range Capability. (Task:%s)"),
-			*UPulseSystemLibrary::FileSizeToString(FileSize), *UPulseSystemLibrary::FileSizeToString(DownloadManager->_downloadChunkMBSize * 1024 * 1024),
+			*UPulseSystemLibrary::FileSizeToString(FileSize), *UPulseSystemLibrary::FileSizeToString(rangeThresholdMb * 1024 * 1024),
 			*DownloadTask->Identifier.ToString());
 		// The file size is larger than a chunk. checking server capability to download in ranges
 		VerifyRangeRequest(DownloadTask->Identifier.Url, [DownloadId, FileName, Succeeded, FileSize](bool bDoSupportRange)-> void
@@ -381,6 +436,8 @@ void UPulseDownloader::BindDownloadTask(UPulseDownloadTask* DownloadTask)
 		DownloadTask->OnTaskPaused.AddUObject(this, &UPulseDownloader::OnPausedDownloadTask);
 	if (!DownloadTask->OnTaskUpdate.IsBoundToObject(this))
 		DownloadTask->OnTaskUpdate.AddUObject(this, &UPulseDownloader::OnUpdateDownloadTask);
+	if (!DownloadTask->OnTaskSlotReleased.IsBoundToObject(this))
+		DownloadTask->OnTaskSlotReleased.AddUObject(this, &UPulseDownloader::OnSlotReleasedDownloadTask);
 	DownloadTask->bIsBound = true;
 }
 
@@ -393,6 +450,7 @@ void UPulseDownloader::UnbindDownloadTask(UPulseDownloadTask* DownloadTask) cons
 	DownloadTask->OnTaskFailed.RemoveAll(this);
 	DownloadTask->OnTaskPaused.RemoveAll(this);
 	DownloadTask->OnTaskUpdate.RemoveAll(this);
+	DownloadTask->OnTaskSlotReleased.RemoveAll(this);
 	DownloadTask->bIsBound = false;
 }
 
@@ -400,6 +458,12 @@ void UPulseDownloader::OnUpdateDownloadTask(UPulseDownloadTask* DownloadTask)
 {
 	if (!DownloadTask)
 		return;
+	if (_bAdaptiveDownloadConnections && _connectionTuner.AddSample(DownloadTask->ConsumeReceivedBytes(), FPlatformTime::Seconds()))
+	{
+		UE_LOG(LogPulseDownloader, Verbose, TEXT("Download connections tuned to %d (%s/s)"), _connectionTuner.GetConnections(),
+			*UPulseSystemLibrary::FileSizeToString(_connectionTuner.GetThroughput()));
+		ScheduleChunks();
+	}
 	BroadcastDownloadEvent(DownloadTask->Identifier.Id, EPulseDownloadState::Downloading);
 }
 
@@ -457,6 +521,11 @@ void UPulseDownloader::OnPausedDownloadTask(UPulseDownloadTask* DownloadTask)
 	StartQueueDownload();
 }
 
+void UPulseDownloader::OnSlotReleasedDownloadTask(UPulseDownloadTask* DownloadTask)
+{
+	ScheduleChunks();
+}
+
 void UPulseDownloader::SaveRememberFile()
 {
 	for (const auto& entry : Downloads)
@@ -571,7 +640,8 @@ void UPulseDownloader::OnRememberFileSaved(const FString& SlotName, int UserInde
 }
 
 
-bool UPulseDownloader::StartDownload(const FString& Url, FGuid& OutDownloadId, const FString& DownloadDirectory, bool bImmediateStart)
+bool UPulseDownloader::StartDownload(const FString& Url, FGuid& OutDownloadId, const FString& DownloadDirectory, bool bImmediateStart, const FString& ExpectedHash,
+                                     EPulseDownloadPriority Priority)
 {
 	if (Url.IsEmpty())
 		return false;
@@ -587,6 +657,16 @@ bool UPulseDownloader::StartDownload(const FString& Url, FGuid& OutDownloadId, c
 		return false;
 	}
 	Identifier.SavedState = bImmediateStart ? EPulseDownloadState::Downloading : EPulseDownloadState::None;
+	Identifier.HashType = _downloadHashType;
+	Identifier.ExpectedHash = ExpectedHash;
+	Identifier.Priority = Priority;
+	Identifier.bAdaptiveChunks = _bAdaptiveChunkSize;
+	if (!ExpectedHash.IsEmpty() && _downloadHashType == EPulseDownloadHash::None)
+	{
+		// Only verified downloads pay for hashing. The digest length tells which algorithm produced it, the fast one by default.
+		const bool bIsMD5 = ExpectedHash.Len() == FPulseTreeHasher::GetDigestSize(EPulseDownloadHash::MD5) * 2;
+		Identifier.HashType = bIsMD5 ? EPulseDownloadHash::MD5 : EPulseDownloadHash::XxHash64;
+	}
 	GetFileNameFromURL(Url, Identifier.FileName);
 	if (StartDownload_Internal(Identifier))
 	{
@@ -672,6 +752,21 @@ bool UPulseDownloader::CancelDownload(const FGuid& DownloadId)
 	return true;
 }
 
+bool UPulseDownloader::SetDownloadPriority(const FGuid& DownloadId, EPulseDownloadPriority Priority)
+{
+	if (!Downloads.Contains(DownloadId))
+		return false;
+	if (!Downloads[DownloadId])
+		return false;
+	Downloads[DownloadId]->Identifier.Priority = Priority;
+	return true;
+}
+
+int32 UPulseDownloader::GetDownloadConnectionCount() const
+{
+	return _bAdaptiveDownloadConnections ? _connectionTuner.GetConnections() : _maxDownloadConnections;
+}
+
 bool UPulseDownloader::GetDownloads(TArray<FGuid>& OutDownloadIds) const
 {
 	OutDownloadIds.Empty();
@@ -778,6 +873,20 @@ bool UPulseDownloader::GetDownloadProgress(const FGuid& DownloadId, float& OutPr
 	return false;
 }
 
+bool UPulseDownloader::GetDownloadMergeProgress(const FGuid& DownloadId, float& OutProgress) const
+{
+	OutProgress = 0.0f;
+	if (!Downloads.Contains(DownloadId))
+		return false;
+	if (!Downloads[DownloadId])
+		return false;
+	auto DownloadTask = Downloads[DownloadId];
+	if (!DownloadTask->IsMerging())
+		return false;
+	OutProgress = DownloadTask->GetMergeProgress();
+	return true;
+}
+
 bool UPulseDownloader::GetDetailedDownloadProgress(const FGuid& DownloadId, TArray<float>& OutProgresses) const
 {
 	OutProgresses.Empty();
@@ -854,7 +963,17 @@ void UPulseDownloader::Initialize(FSubsystemCollectionBase& Collection)
 		_downloadChunkRetries = config->DownloadChunkRetries;
 		_fileInfosQueryTimeOutSeconds = config->FileInfosQueryTimeOutSeconds;
 		_maxConcurrentChunks = config->MaxConcurrentChunks;
+		_downloadWriteBufferKBSize = config->DownloadWriteBufferKBSize;
+		_downloadHashType = config->DownloadHashType;
+		_maxDownloadConnections = FMath::Max(config->MaxDownloadConnections, 1);
+		_bAdaptiveDownloadConnections = config->bAdaptiveDownloadConnections;
+		_minDownloadConnections = config->MinDownloadConnections;
+		_bAdaptiveChunkSize = config->bAdaptiveChunkSize;
+		_minDownloadChunkMBSize = FMath::Clamp(config->MinDownloadChunkMBSize, 1, FMath::Max(_downloadChunkMBSize, 1));
+		_targetChunkSeconds = config->TargetChunkSeconds;
+		_maxChunkRetryMBCost = config->MaxChunkRetryMBCost;
 	}
+	_connectionTuner.Initialize(_minDownloadConnections, _maxDownloadConnections);
 	LoadRememberFile();
 }
 
@@ -864,6 +983,13 @@ void UPulseDownloader::StartQueueDownload()
 		return;
 	TArray<FGuid> DownloadIds;
 	Downloads.GetKeys(DownloadIds);
+	// Foreground first
+	Algo::StableSort(DownloadIds, [this](const FGuid& A, const FGuid& B)
+	{
+		const auto priorityA = Downloads[A] ? Downloads[A]->Identifier.Priority : EPulseDownloadPriority::Background;
+		const auto priorityB = Downloads[B] ? Downloads[B]->Identifier.Priority : EPulseDownloadPriority::Background;
+		return priorityA > priorityB;
+	});
 	for (const auto& id : DownloadIds)
 	{
 		if (!Downloads[id])
@@ -996,3 +1122,8 @@ FString UPulseDownloader::ToString(const FDownloadIdentifier& Identifier)
 {
 	return Identifier.ToString();
 }
+
+FString UPulseDownloader::ComputeDownloadHash(const FString& FilePath, EPulseDownloadHash HashType)
+{
+	return FPulseTreeHasher::HashFile(FilePath, HashType);
+}
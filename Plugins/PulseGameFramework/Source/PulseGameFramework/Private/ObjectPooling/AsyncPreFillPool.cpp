@@ -0,0 +1,77 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+
+#include "ObjectPooling/AsyncPreFillPool.h"
+#include "ObjectPooling/PulseObjectPooling.h"
+
+
+UAsyncPreFillPool* UAsyncPreFillPool::WaitPreFillPool(UObject* WorldContextObject, TArray<TSubclassOf<UObject>> ObjectClasses, int32 CountPerObject, float FrameBudgetMs,
+                                                      int32 MaxSpawnPerFrame)
+{
+	UAsyncPreFillPool* Node = NewObject<UAsyncPreFillPool>();
+	Node->_worldContext = WorldContextObject;
+	Node->_classes = ObjectClasses;
+	Node->_countPerObject = CountPerObject;
+	Node->_frameBudgetMs = FrameBudgetMs;
+	Node->_maxSpawnPerFrame = MaxSpawnPerFrame;
+	// Register with the game instance to avoid being garbage collected
+	Node->RegisterWithGameInstance(WorldContextObject);
+	return Node;
+}
+
+void UAsyncPreFillPool::Cancel()
+{
+	if (auto pooling = _pooling.Get())
+		pooling->CancelPreFillPool(_jobID);
+}
+
+void UAsyncPreFillPool::Activate()
+{
+	auto pooling = UPulseObjectPooling::Get(_worldContext);
+	if (!pooling)
+	{
+		OnCancelled.Broadcast(0, 0);
+		SetReadyToDestroy();
+		return;
+	}
+	_pooling = pooling;
+	pooling->OnPoolPreFillProgress.AddDynamic(this, &UAsyncPreFillPool::OnPreFillProgress_Internal);
+	pooling->OnPoolPreFillCompleted.AddDynamic(this, &UAsyncPreFillPool::OnPreFillCompleted_Internal);
+	_jobID = pooling->PreFillPoolAsync(_classes, _countPerObject, _frameBudgetMs, _maxSpawnPerFrame);
+	if (!_jobID.IsValid())
+	{
+		// Nothing to pre-fill, the pools are already full.
+		Finish_Internal();
+		OnCompleted.Broadcast(0, 0);
+	}
+}
+
+void UAsyncPreFillPool::OnPreFillProgress_Internal(const FGuid& JobID, int32 FilledCount, int32 TotalCount)
+{
+	if (JobID != _jobID)
+		return;
+	_filledCount = FilledCount;
+	_totalCount = TotalCount;
+	OnProgress.Broadcast(FilledCount, TotalCount);
+}
+
+void UAsyncPreFillPool::OnPreFillCompleted_Internal(const FGuid& JobID, bool bCancelled)
+{
+	if (JobID != _jobID)
+		return;
+	Finish_Internal();
+	if (bCancelled)
+		OnCancelled.Broadcast(_filledCount, _totalCount);
+	else
+		OnCompleted.Broadcast(_totalCount, _totalCount);
+}
+
+void UAsyncPreFillPool::Finish_Internal()
+{
+	if (auto pooling = _pooling.Get())
+	{
+		pooling->OnPoolPreFillProgress.RemoveDynamic(this, &UAsyncPreFillPool::OnPreFillProgress_Internal);
+		pooling->OnPoolPreFillCompleted.RemoveDynamic(this, &UAsyncPreFillPool::OnPreFillCompleted_Internal);
+	}
+	SetReadyToDestroy();
+}
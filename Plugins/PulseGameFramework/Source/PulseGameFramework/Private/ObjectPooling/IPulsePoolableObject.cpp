@@ -9,11 +9,37 @@
 // Add default functionality here for any IIPoolingObject functions that are not pure virtual.
 
 
-bool IIPulsePoolableObject::OnPoolQuery_Implementation(const FPoolingParams SpawnData)
+bool IIPulsePoolableObject::OnPoolQuery_Implementation(FPoolingParams SpawnData)
 {
 	return true;
 }
 
+// Blueprint events need an FPoolingParams. Only build one when the view does not come from one already.
+// The event takes it by value, only the native OnPoolQueryNative path avoids the copy.
+static bool CallOnPoolQueryEvent(UObject* Object, const FPoolingParamsView& SpawnData)
+{
+	if (SpawnData.Source)
+		return IIPulsePoolableObject::Execute_OnPoolQuery(Object, *SpawnData.Source);
+	FPoolingParams params;
+	SpawnData.ToParams(params);
+	return IIPulsePoolableObject::Execute_OnPoolQuery(Object, params);
+}
+
+bool IIPulsePoolableObject::OnPoolQueryNative(const FPoolingParamsView& SpawnData)
+{
+	return CallOnPoolQueryEvent(Cast<UObject>(this), SpawnData);
+}
+
+bool IIPulsePoolableObject::DispatchPoolQuery(UObject* Object, const FPoolingParamsView& SpawnData)
+{
+	if (!Object)
+		return false;
+	if (auto nativePoolable = Cast<IIPulsePoolableObject>(Object))
+		return nativePoolable->OnPoolQueryNative(SpawnData);
+	// Interface only implemented in blueprint.
+	return CallOnPoolQueryEvent(Object, SpawnData);
+}
+
 void IIPulsePoolableObject::OnPoolDispose_Implementation()
 {
 }
@@ -15,26 +15,75 @@ void UPulseObjectPooling::Initialize(FSubsystemCollectionBase& Collection)
 	if (const auto projectConfig = GetProjectSettings())
 	{
 		_globalPoolLimit = projectConfig->GlobalPoolLimit;
+		_cleanUpBudgetPerTick = projectConfig->PoolCleanUpBudgetPerTick;
+		_preFillFrameBudgetMs = projectConfig->PoolPreFillFrameBudgetMs;
+		_preFillMaxSpawnPerFrame = projectConfig->PoolPreFillMaxSpawnPerFrame;
+		_bAdaptivePoolSizing = projectConfig->bAdaptivePoolSizing;
+		_adaptiveSizingInterval = projectConfig->AdaptivePoolSizingInterval;
+		_adaptiveHeadroom = projectConfig->AdaptivePoolHeadroom;
+		_bNetDormantPooledActors = projectConfig->bNetDormantPooledActors;
 	}
 #if WITH_EDITOR
 	_DuplicateDelegate = FCoreUObjectDelegates::OnObjectsReplaced.AddUObject(this, &UPulseObjectPooling::OnObjectsReplaced_Internal);
 #endif
-	_DeleteDelegate = FCoreUObjectDelegates::PreGarbageCollectConditionalBeginDestroy.AddUObject(this, &UPulseObjectPooling::OnGCPreDestroy_Internal);
+	_PostGCDelegate = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UPulseObjectPooling::OnPostGarbageCollect_Internal);
 	UE_LOG(LogPulseObjectPooling, Log, TEXT("Pooling sub-system initialized"));
 }
 
 void UPulseObjectPooling::Deinitialize()
 {
+	// Pending pre-fills end as cancelled, so their async nodes complete and get released.
+	const TArray<FPoolPreFillJob> pendingJobs = MoveTemp(_preFillJobs);
+	_preFillJobs.Empty();
+	for (const auto& job : pendingJobs)
+		OnPoolPreFillCompleted.Broadcast(job.JobID, true);
 	Super::Deinitialize();
 	ClearPool();
+	_actorDormancy.Empty();
+	_poolStats.Empty();
+	_adaptivePreFillJobs.Empty();
 #if WITH_EDITOR
 	if (_DuplicateDelegate.IsValid())
 		FCoreUObjectDelegates::OnObjectsReplaced.Remove(_DuplicateDelegate);
 #endif
 	_DuplicateDelegate.Reset();
-	if (_DeleteDelegate.IsValid())
-		FCoreUObjectDelegates::PreGarbageCollectConditionalBeginDestroy.Remove(_DeleteDelegate);
-	_DeleteDelegate.Reset();
+	if (_PostGCDelegate.IsValid())
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(_PostGCDelegate);
+	_PostGCDelegate.Reset();
+	_sweepClasses.Empty();
+}
+
+TStatId UPulseObjectPooling::GetStatId() const
+{
+	return Super::GetStatID();
+}
+
+ETickableTickType UPulseObjectPooling::GetTickableTickType() const
+{
+	return IsInitialized() ? ETickableTickType::Conditional : ETickableTickType::Never;
+}
+
+bool UPulseObjectPooling::IsTickable() const
+{
+	// Only tick while a clean up sweep or a pre-fill is pending, or to adapt pool sizes.
+	return IsInitialized() && (_bAdaptivePoolSizing || !_sweepClasses.IsEmpty() || !_preFillJobs.IsEmpty());
+}
+
+void UPulseObjectPooling::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PulseObjectPooling::Tick);
+	Super::Tick(DeltaTime);
+	ProcessPreFillJobs_Internal();
+	SweepPools_Internal(_cleanUpBudgetPerTick);
+	if (_bAdaptivePoolSizing)
+	{
+		_adaptiveSizingTimer += DeltaTime;
+		if (_adaptiveSizingTimer >= _adaptiveSizingInterval)
+		{
+			_adaptiveSizingTimer = 0;
+			AdaptPoolSizes_Internal();
+		}
+	}
 }
 
 bool UPulseObjectPooling::DoesSupportWorldType(const EWorldType::Type WorldType) const
@@ -86,6 +135,8 @@ UObject* UPulseObjectPooling::CreateNewObject(TSubclassOf<UObject> ObjectClass,
 			}
 		}
 	}
+	if (Object)
+		_poolStats.FindOrAdd(ObjectClass).Creations++;
 	UE_LOG(LogPulseObjectPooling, Log, TEXT("Created new object of type %s"), *Class->GetName());
 	return Object;
 }
@@ -97,25 +148,19 @@ void UPulseObjectPooling::MoveObjectToLivePool(TObjectPtr<UObject> Object)
 	auto ObjectClass = Object->GetClass();
 	if (IsValid(Object))
 	{
-		if (PoolingLiveObjectMap.Contains(ObjectClass))
-		{
-			// If the object type is already in the live pool, Add this instance to his list.
-			PoolingLiveObjectMap[ObjectClass].Add(Object);
-		}
-		else
-		{
-			// If not, Add it.
-			PoolingLiveObjectMap.Add(ObjectClass, FPoolingTypeObjects({Object}));
-		}
+		// Add this instance to the live list of its type, creating the list if needed.
+		auto& liveObjects = PoolingLiveObjectMap.FindOrAdd(ObjectClass);
+		liveObjects.Add(Object);
+		_poolStats.FindOrAdd(ObjectClass).RecordLiveCount(liveObjects.Count());
 	}
 
 	// Remove any reference to this object in the dormant pool.
-	if (PoolingDormantObjectMap.Contains(ObjectClass))
+	if (auto dormantObjects = PoolingDormantObjectMap.Find(ObjectClass))
 	{
-		PoolingDormantObjectMap[ObjectClass].Remove(Object);
+		dormantObjects->Remove(Object);
 
 		// if the array is empty, remove the entry from the map
-		if (!PoolingDormantObjectMap[ObjectClass].IsValid())
+		if (!dormantObjects->IsValid())
 		{
 			PoolingDormantObjectMap.Remove(ObjectClass);
 			OnPoolCleared.Broadcast(ObjectClass);
@@ -130,25 +175,19 @@ void UPulseObjectPooling::MoveObjectToDormantPool(TObjectPtr<UObject> Object)
 	auto ObjectClass = Object->GetClass();
 	if (IsValid(Object))
 	{
-		if (PoolingDormantObjectMap.Contains(ObjectClass))
-		{
-			// If the object type is already in the Dormant pool, Add this instance to his list.
-			PoolingDormantObjectMap[ObjectClass].Add(Object);
-		}
-		else
-		{
-			// If not, Add it.
-			PoolingDormantObjectMap.Add(ObjectClass, FPoolingTypeObjects({Object}));
-		}
+		// Add this instance to the dormant list of its type, creating the list if needed.
+		auto& dormantObjects = PoolingDormantObjectMap.FindOrAdd(ObjectClass);
+		dormantObjects.Add(Object);
+		_poolStats.FindOrAdd(ObjectClass).RecordDormantCount(dormantObjects.Count());
 	}
 
 	// Remove any reference to this object in the live pool.
-	if (PoolingLiveObjectMap.Contains(ObjectClass))
+	if (auto liveObjects = PoolingLiveObjectMap.Find(ObjectClass))
 	{
-		PoolingLiveObjectMap[ObjectClass].Remove(Object);
+		liveObjects->Remove(Object);
 
 		// if the array is empty, remove the entry from the map
-		if (!PoolingLiveObjectMap[ObjectClass].IsValid())
+		if (!liveObjects->IsValid())
 		{
 			PoolingLiveObjectMap.Remove(ObjectClass);
 			OnPoolCleared.Broadcast(ObjectClass);
@@ -179,17 +218,190 @@ void UPulseObjectPooling::CleanUpPools(TObjectPtr<UClass> Class)
 	}
 }
 
+void UPulseObjectPooling::SweepPools_Internal(int32 Budget)
+{
+	while (Budget > 0 && _sweepClasses.IsValidIndex(_sweepClassIndex))
+	{
+		const auto clas = _sweepClasses[_sweepClassIndex];
+		auto& poolMap = _bSweepingDormant ? PoolingDormantObjectMap : PoolingLiveObjectMap;
+		if (auto objects = poolMap.Find(clas))
+		{
+			if (!objects->CleanStep(Budget))
+				return; // Out of budget, resume this class on the next tick.
+			if (!objects->IsValid())
+			{
+				poolMap.Remove(clas);
+				OnPoolCleared.Broadcast(clas);
+			}
+		}
+		if (_bSweepingDormant)
+			_sweepClassIndex++;
+		_bSweepingDormant = !_bSweepingDormant;
+	}
+	if (!_sweepClasses.IsValidIndex(_sweepClassIndex))
+	{
+		// Drop the dormancy state of actors destroyed while pooled.
+		for (auto It = _actorDormancy.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().ResolveObjectPtr())
+				It.RemoveCurrent();
+		}
+		_sweepClasses.Reset();
+		_sweepClassIndex = 0;
+		_bSweepingDormant = false;
+	}
+}
+
+int32 UPulseObjectPooling::EvictDormantObjects_Internal(TSubclassOf<UObject> Class, int32 Count)
+{
+	auto dormantObjects = PoolingDormantObjectMap.Find(Class);
+	if (!dormantObjects || Count <= 0)
+		return 0;
+	int32 evicted = 0;
+	while (evicted < Count)
+	{
+		UObject* Object = dormantObjects->TrimInvalidLast();
+		if (!Object)
+			break;
+		dormantObjects->Remove(Object);
+		if (auto asActor = Cast<AActor>(Object))
+		{
+			_actorDormancy.Remove(FObjectKey(asActor));
+			asActor->Destroy();
+		}
+		else if (auto asComponent = Cast<UActorComponent>(Object))
+			asComponent->ConditionalBeginDestroy();
+		else
+			Object->MarkAsGarbage();
+		evicted++;
+	}
+	if (auto stats = _poolStats.Find(Class))
+		stats->Evictions += evicted;
+	if (!dormantObjects->IsValid())
+	{
+		PoolingDormantObjectMap.Remove(Class);
+		OnPoolCleared.Broadcast(Class);
+	}
+	return evicted;
+}
+
+void UPulseObjectPooling::AdaptPoolSizes_Internal()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PulseObjectPooling::AdaptPoolSizes);
+	// Decide first, then resize: evictions and pre-fills add to the stats map while it would be iterated.
+	TArray<TTuple<TSubclassOf<UObject>, int32>> resizes;
+	for (auto& item : _poolStats)
+	{
+		const auto clas = item.Key;
+		auto& stats = item.Value;
+		if (!clas)
+			continue;
+		const auto liveObjects = PoolingLiveObjectMap.Find(clas);
+		const auto dormantObjects = PoolingDormantObjectMap.Find(clas);
+		const int32 liveCount = liveObjects ? liveObjects->Count() : 0;
+		const int32 dormantCount = dormantObjects ? dormantObjects->Count() : 0;
+		// Use the two last windows, so a single quiet window doesn't drop the whole reserve.
+		const int32 highWaterMark = FMath::Max(stats.WindowPeakLive, stats.PreviousWindowPeakLive);
+		stats.PreviousWindowPeakLive = stats.WindowPeakLive;
+		stats.WindowPeakLive = liveCount;
+		const int32 targetDormant = FMath::Max(FMath::CeilToInt32(highWaterMark * _adaptiveHeadroom) - liveCount, 0);
+		if (dormantCount != targetDormant)
+			resizes.Add(MakeTuple(clas, targetDormant - dormantCount));
+	}
+	for (const auto& resize : resizes)
+	{
+		const auto clas = resize.Get<0>();
+		const int32 delta = resize.Get<1>();
+		if (delta < 0)
+		{
+			const int32 evicted = EvictDormantObjects_Internal(clas, -delta);
+			UE_LOG(LogPulseObjectPooling, Log, TEXT("Adaptive sizing: evicted %d dormant %s"), evicted, *clas->GetName());
+		}
+		else
+		{
+			const FGuid* pendingJob = _adaptivePreFillJobs.Find(clas);
+			if (pendingJob && IsPreFillingPool(*pendingJob))
+				continue;
+			const FGuid jobID = PreFillPoolAsync({clas}, delta);
+			if (jobID.IsValid())
+				_adaptivePreFillJobs.Add(clas, jobID);
+		}
+	}
+}
+
+bool UPulseObjectPooling::GetPoolClassStats(TSubclassOf<UObject> Class, FPoolClassStats& OutStats) const
+{
+	const auto stats = _poolStats.Find(Class);
+	if (!stats)
+		return false;
+	OutStats = *stats;
+	return true;
+}
+
+void UPulseObjectPooling::ResetPoolStats()
+{
+	for (auto& item : _poolStats)
+	{
+		const auto liveObjects = PoolingLiveObjectMap.Find(item.Key);
+		const auto dormantObjects = PoolingDormantObjectMap.Find(item.Key);
+		item.Value = FPoolClassStats();
+		item.Value.RecordLiveCount(liveObjects ? liveObjects->Count() : 0);
+		item.Value.RecordDormantCount(dormantObjects ? dormantObjects->Count() : 0);
+	}
+}
+
+void UPulseObjectPooling::SetAdaptivePoolSizing(bool bEnable)
+{
+	_bAdaptivePoolSizing = bEnable;
+	_adaptiveSizingTimer = 0;
+}
+
+void UPulseObjectPooling::SetPooledActorDormant_Internal(AActor* Actor, bool bDormant)
+{
+	if (!Actor)
+		return;
+	// Don't create a state just to say an actor is awake, it already is.
+	auto dormancy = bDormant ? &_actorDormancy.FindOrAdd(FObjectKey(Actor)) : _actorDormancy.Find(FObjectKey(Actor));
+	if (dormancy)
+		dormancy->SetDormant(Actor, bDormant, _bNetDormantPooledActors);
+}
+
 void UPulseObjectPooling::OnDestroyLinkedActor_Internal(AActor* Actor)
 {
 	if (!Actor)
 		return;
-	if (!_linkedPoolObjectActors.Contains(Actor))
+	// Detach the whole owner entry at once, so disposing its objects doesn't touch the linked map again.
+	FPoolingTypeObjects ownedObjects;
+	if (!_linkedPoolObjectActors.RemoveAndCopyValue(Actor, ownedObjects))
 		return;
-	_linkedPoolObjectActors[Actor].ForAllValid([this](UObject* Obj)
+	Actor->OnDestroyed.RemoveDynamic(this, &UPulseObjectPooling::OnDestroyLinkedActor_Internal);
+	// Released as one batch, sorted so each class is disposed in a single run.
+	TArray<UObject*> disposing;
+	disposing.Reserve(ownedObjects.Count());
+	ownedObjects.ForAllValid([this, &disposing](UObject* Obj)
 	{
-		DisposeObject(Obj);
+		_pooledObjectOwners.Remove(FObjectKey(Obj));
+		disposing.Add(Obj);
 	});
-	_linkedPoolObjectActors.Remove(Actor);
+	disposing.Sort([](const UObject& A, const UObject& B) { return A.GetClass() < B.GetClass(); });
+	DisposeObjects(disposing);
+}
+
+void UPulseObjectPooling::UnlinkObjectFromOwner_Internal(UObject* Object)
+{
+	TWeakObjectPtr<AActor> owner;
+	if (!_pooledObjectOwners.RemoveAndCopyValue(FObjectKey(Object), owner))
+		return;
+	auto ownedObjects = _linkedPoolObjectActors.Find(owner);
+	if (!ownedObjects)
+		return;
+	ownedObjects->Remove(Object);
+	if (ownedObjects->Count() <= 0)
+	{
+		if (auto ownerActor = owner.Get())
+			ownerActor->OnDestroyed.RemoveDynamic(this, &UPulseObjectPooling::OnDestroyLinkedActor_Internal);
+		_linkedPoolObjectActors.Remove(owner);
+	}
 }
 
 void UPulseObjectPooling::OnObjectsReplaced_Internal(const TMap<UObject*, UObject*>& ReplacementMap)
@@ -216,16 +428,16 @@ void UPulseObjectPooling::OnObjectsReplaced_Internal(const TMap<UObject*, UObjec
 	}
 }
 
-void UPulseObjectPooling::OnGCPreDestroy_Internal()
+void UPulseObjectPooling::OnPostGarbageCollect_Internal()
 {
-	TArray<TSubclassOf<UObject>> allDormantClasses;
-	TArray<TSubclassOf<UObject>> allLiveClasses;
-	PoolingDormantObjectMap.GetKeys(allDormantClasses);
-	PoolingLiveObjectMap.GetKeys(allLiveClasses);
-	for (auto clas : allLiveClasses)
-		CleanUpPools(clas);
-	for (auto clas : allDormantClasses)
-		CleanUpPools(clas);
+	// Objects collected while pooled leave null entries behind. Sweep them over the next frames instead of all at once.
+	if (_cleanUpBudgetPerTick <= 0 || !_sweepClasses.IsEmpty())
+		return;
+	PoolingLiveObjectMap.GetKeys(_sweepClasses);
+	for (const auto& item : PoolingDormantObjectMap)
+		_sweepClasses.AddUnique(item.Key);
+	_sweepClassIndex = 0;
+	_bSweepingDormant = false;
 }
 
 EPoolQueryResult UPulseObjectPooling::DisposeObject_Internal(UObject* Object)
@@ -241,25 +453,25 @@ EPoolQueryResult UPulseObjectPooling::DisposeObject_Internal(UObject* Object)
 		UE_LOG(LogPulseObjectPooling, Error, TEXT("Cannot Dispose: Class is somehow not valid"));
 		return EPoolQueryResult::BadOrNullObjectClass;
 	}
-	if (!PoolingLiveObjectMap.Contains(ObjectClass))
+	const auto liveObjects = PoolingLiveObjectMap.Find(ObjectClass);
+	if (!liveObjects)
 	{
 		UE_LOG(LogPulseObjectPooling, Error, TEXT("Cannot Dispose Object's %s: Class %s not present in the live pool"), *ObjectClass->GetName(), *ObjectClass->GetName());
 		return EPoolQueryResult::PoolLimitReached; // Object is not in the live pool, nothing to do.
 	}
-	if (!PoolingLiveObjectMap[ObjectClass].Contains(Object))
+	if (!liveObjects->Contains(Object))
 	{
 		UE_LOG(LogPulseObjectPooling, Error, TEXT("Cannot Dispose Object %s (%s): doesn't belong to the live pool"), *Object->GetName(), *GetNameSafe(Object->GetOuter()));
 		return EPoolQueryResult::PoolLimitReached; // Object is not in the live pool, nothing to do.
 	}
 
-	CleanUpPools(ObjectClass);
 	if (Object->Implements<UIPulsePoolableObject>())
 	{
 		IIPulsePoolableObject::Execute_OnPoolDispose(Object);
 	}
 	if (auto asActor = Cast<AActor>(Object))
 	{
-		UPulseSystemLibrary::EnableActor(asActor, false);
+		SetPooledActorDormant_Internal(asActor, true);
 	}
 	else if (auto asComponent = Cast<UActorComponent>(Object))
 	{
@@ -269,35 +481,36 @@ EPoolQueryResult UPulseObjectPooling::DisposeObject_Internal(UObject* Object)
 	}
 
 	// If the returned object was previously requested by an actor, we need to remove it from the linked actor list.
-	TArray<TWeakObjectPtr<AActor>> actorKeys;
-	_linkedPoolObjectActors.GetKeys(actorKeys);
-	for (auto itemKey : actorKeys)
-	{
-		_linkedPoolObjectActors[itemKey].Remove(Object);
-		if (_linkedPoolObjectActors[itemKey].Count() <= 0)
-		{
-			itemKey->OnDestroyed.RemoveDynamic(this, &UPulseObjectPooling::OnDestroyLinkedActor_Internal);
-			_linkedPoolObjectActors.Remove(itemKey);
-		}
-	}
+	UnlinkObjectFromOwner_Internal(Object);
 
 	// If the number of dormant objects for this class is greater than the limit, we need to destroy the object.
-	int32 PoolLimit = PerClassPoolLimit.Contains(ObjectClass) ? PerClassPoolLimit[ObjectClass] : _globalPoolLimit;
-	int32 DormantCount = PoolingDormantObjectMap.Contains(ObjectClass) ? PoolingDormantObjectMap[ObjectClass].Count() : 0;
-	UE_LOG(LogPulseObjectPooling, Log, TEXT("Object %s Disposed Successfully"), *Object->GetName());
+	const int32* classLimit = PerClassPoolLimit.Find(ObjectClass);
+	const auto dormantObjects = PoolingDormantObjectMap.Find(ObjectClass);
+	int32 PoolLimit = classLimit ? *classLimit : _globalPoolLimit;
+	int32 DormantCount = dormantObjects ? dormantObjects->Count() : 0;
+	if (DormantCount >= PoolLimit)
+	{
+		// Stale entries may be counted, only pay for a full clean up when the limit seems reached.
+		CleanUpPools(ObjectClass);
+		const auto cleanDormantObjects = PoolingDormantObjectMap.Find(ObjectClass);
+		DormantCount = cleanDormantObjects ? cleanDormantObjects->Count() : 0;
+	}
+	UE_LOG(LogPulseObjectPooling, Verbose, TEXT("Object %s Disposed Successfully"), *Object->GetName());
 	if (DormantCount >= PoolLimit)
 	{
 		// If the pool is full, we need to destroy the object.
+		_poolStats.FindOrAdd(ObjectClass).Evictions++;
 		if (auto asActor = Cast<AActor>(Object))
 		{
+			_actorDormancy.Remove(FObjectKey(asActor));
 			asActor->Destroy();
 		}
 		else if (auto asComponent = Cast<UActorComponent>(Object))
 		{
 			asComponent->ConditionalBeginDestroy();
 		}
-		PoolingLiveObjectMap[ObjectClass].Remove(Object);
-		if (PoolingLiveObjectMap[ObjectClass].Count() <= 0)
+		auto liveSet = PoolingLiveObjectMap.Find(ObjectClass);
+		if (liveSet && liveSet->Remove(Object) && liveSet->Count() <= 0)
 		{
 			// If the array is empty, remove the entry from the map
 			PoolingLiveObjectMap.Remove(ObjectClass);
@@ -319,35 +532,53 @@ UPulseObjectPooling* UPulseObjectPooling::Get(const UObject* WorldContext)
 	return world->GetSubsystem<UPulseObjectPooling>();
 }
 
-EPoolQueryResult UPulseObjectPooling::QueryObject(UObject* Owner, TSubclassOf<UObject> Class, UObject*& Output, FPoolingParams QueryParams)
+EPoolQueryResult UPulseObjectPooling::QueryObject(UObject* Owner, TSubclassOf<UObject> Class, UObject*& Output, const FPoolingParams& QueryParams)
+{
+	return QueryObject(Owner, Class, Output, FPoolingParamsView(QueryParams));
+}
+
+EPoolQueryResult UPulseObjectPooling::QueryObject(UObject* Owner, TSubclassOf<UObject> Class, UObject*& Output, const FTransform& SpawnTransform)
+{
+	return QueryObject(Owner, Class, Output, FPoolingParamsView(SpawnTransform));
+}
+
+EPoolQueryResult UPulseObjectPooling::QueryObject(UObject* Owner, TSubclassOf<UObject> Class, UObject*& Output, const FPoolingParamsView& QueryParams)
 {
 	if (!Class)
 	{
 		UE_LOG(LogPulseObjectPooling, Error, TEXT("Cannot QueryObject: Null object class"));
 		return EPoolQueryResult::BadOrNullObjectClass;
 	}
+	const double queryStart = FPlatformTime::Seconds();
 	UObject* Object = nullptr;
 	auto ObjectClass = Class;
 	bool createdNewObject = false;
-	CleanUpPools(ObjectClass);
 
-	if (PoolingDormantObjectMap.Contains(ObjectClass) && PoolingDormantObjectMap[ObjectClass].IsValid())
-	{
-		// If the pool is not empty, get the first object from the dormant pool.
-		Object = PoolingDormantObjectMap[ObjectClass].GetFirst();
-	}
-	else
+	// If the pool is not empty, get the most recently disposed object from the dormant pool, skipping destroyed ones.
+	if (const auto dormantObjects = PoolingDormantObjectMap.Find(ObjectClass))
+		Object = dormantObjects->TrimInvalidLast();
+	if (!Object)
 	{
 		// Get the limit value that will be used to check if we can create a new object.
 		int32 PoolLimit = PerClassPoolLimit.Contains(ObjectClass)
 			                  ? PerClassPoolLimit[ObjectClass]
 			                  : _globalPoolLimit;
 		// Get the number of objects in the live and dormant pool for this class.
-		int32 LiveCount = PoolingLiveObjectMap.Contains(ObjectClass) ? PoolingLiveObjectMap[ObjectClass].Count() : 0;
-		int32 DormantCount = PoolingDormantObjectMap.Contains(ObjectClass) ? PoolingDormantObjectMap[ObjectClass].Count() : 0;
+		auto getPoolCount = [this, ObjectClass]()
+		{
+			const auto liveObjects = PoolingLiveObjectMap.Find(ObjectClass);
+			const auto dormantObjects = PoolingDormantObjectMap.Find(ObjectClass);
+			return (liveObjects ? liveObjects->Count() : 0) + (dormantObjects ? dormantObjects->Count() : 0);
+		};
+		// Stale entries may be counted, only pay for a full clean up when the limit seems reached.
+		if (getPoolCount() >= PoolLimit)
+			CleanUpPools(ObjectClass);
 		// If the total number of objects in the live and dormant pool is greater than or equal to the pool limit, we can't create a new object.
-		if ((LiveCount + DormantCount) >= PoolLimit)
+		if (getPoolCount() >= PoolLimit)
+		{
+			_poolStats.FindOrAdd(ObjectClass).LimitRefusals++;
 			return EPoolQueryResult::PoolLimitReached;
+		}
 		// If the pool is empty or there are no object for this class yet, create a new object.
 		Object = CreateNewObject(ObjectClass, Owner);
 		if (!Object && Class)
@@ -367,7 +598,7 @@ EPoolQueryResult UPulseObjectPooling::QueryObject(UObject* Owner, TSubclassOf<UO
 	MoveObjectToLivePool(Object);
 	if (auto asActor = Cast<AActor>(Object))
 	{
-		UPulseSystemLibrary::EnableActor(asActor, true);
+		SetPooledActorDormant_Internal(asActor, false);
 	}
 	else if (auto asComponent = Cast<UActorComponent>(Object))
 	{
@@ -387,8 +618,9 @@ EPoolQueryResult UPulseObjectPooling::QueryObject(UObject* Owner, TSubclassOf<UO
 		if (auto compSet = &_linkedPoolObjectActors.FindOrAdd(OwningActor))
 		{
 			compSet->Add(Object);
+			_pooledObjectOwners.Add(FObjectKey(Object), OwningActor);
 			if (compSet->Count() <= 1)
-				OwningActor->OnDestroyed.AddDynamic(this, &UPulseObjectPooling::OnDestroyLinkedActor_Internal);
+				OwningActor->OnDestroyed.AddUniqueDynamic(this, &UPulseObjectPooling::OnDestroyLinkedActor_Internal);
 		}
 	}
 
@@ -397,7 +629,7 @@ EPoolQueryResult UPulseObjectPooling::QueryObject(UObject* Owner, TSubclassOf<UO
 		// If QueryParams is provided, we can set some properties on the object if needed.
 		if (Object->Implements<UIPulsePoolableObject>())
 		{
-			if (!IIPulsePoolableObject::Execute_OnPoolQuery(Object, QueryParams))
+			if (!IIPulsePoolableObject::DispatchPoolQuery(Object, QueryParams))
 			{
 				// If the object does not want to be spawned, we can't use it.
 				DisposeObject_Internal(Object);
@@ -407,15 +639,173 @@ EPoolQueryResult UPulseObjectPooling::QueryObject(UObject* Owner, TSubclassOf<UO
 		}
 	}
 	Output = Object; // Return the object to the caller.
+	// Only objects actually handed out count as hits or misses.
+	auto& classStats = _poolStats.FindOrAdd(ObjectClass);
+	if (createdNewObject)
+		classStats.Misses++;
+	else
+		classStats.Hits++;
+	classStats.RecordAcquire(FPlatformTime::Seconds() - queryStart);
 	if (createdNewObject)
 		OnPoolCreationQuery.Broadcast(ObjectClass);
 	else
 		OnPoolQuery.Broadcast(ObjectClass);
 
-	UE_LOG(LogPulseObjectPooling, Log, TEXT("QueryObject %s(%s) of type %s successful"), *Object->GetName(), *GetNameSafe(Object->GetOuter()), *Class->GetName());
+	UE_LOG(LogPulseObjectPooling, Verbose, TEXT("QueryObject %s(%s) of type %s successful"), *Object->GetName(), *GetNameSafe(Object->GetOuter()), *Class->GetName());
 	return EPoolQueryResult::Success;
 }
 
+EPoolQueryResult UPulseObjectPooling::QueryObjects(UObject* Owner, TSubclassOf<UObject> Class, int32 Count, TArray<UObject*>& Outputs, const FPoolingParams& QueryParams)
+{
+	const FPoolingParamsView paramsView(QueryParams);
+	return QueryObjects_Internal(Owner, Class, Count, Outputs, [&paramsView](int32) { return paramsView; });
+}
+
+EPoolQueryResult UPulseObjectPooling::QueryObjects(UObject* Owner, TSubclassOf<UObject> Class, TArrayView<const FTransform> SpawnTransforms, TArray<UObject*>& Outputs)
+{
+	return QueryObjects_Internal(Owner, Class, SpawnTransforms.Num(), Outputs, [SpawnTransforms](int32 Index) { return FPoolingParamsView(SpawnTransforms[Index]); });
+}
+
+EPoolQueryResult UPulseObjectPooling::QueryObjects_Internal(UObject* Owner, TSubclassOf<UObject> Class, int32 Count, TArray<UObject*>& Outputs, TFunctionRef<FPoolingParamsView(int32)> GetParams)
+{
+	Outputs.Reset(FMath::Max(Count, 0));
+	if (!Class)
+	{
+		UE_LOG(LogPulseObjectPooling, Error, TEXT("Cannot QueryObjects: Null object class"));
+		return EPoolQueryResult::BadOrNullObjectClass;
+	}
+	if (Count <= 0)
+		return EPoolQueryResult::InvalidParams;
+	TRACE_CPUPROFILER_EVENT_SCOPE(PulseObjectPooling::QueryObjects);
+	const double queryStart = FPlatformTime::Seconds();
+	auto ObjectClass = Class;
+
+	// Take as many objects as possible from the dormant pool, most recently disposed first.
+	if (auto dormantObjects = PoolingDormantObjectMap.Find(ObjectClass))
+	{
+		while (Outputs.Num() < Count)
+		{
+			UObject* dormantObject = dormantObjects->TrimInvalidLast();
+			if (!dormantObject)
+				break;
+			dormantObjects->Remove(dormantObject);
+			Outputs.Add(dormantObject);
+		}
+	}
+	const int32 reusedCount = Outputs.Num();
+	int32 limitRefusedCount = 0;
+
+	// Create the missing objects, within the pool limit.
+	if (reusedCount < Count)
+	{
+		const int32* classLimit = PerClassPoolLimit.Find(ObjectClass);
+		const int32 PoolLimit = classLimit ? *classLimit : _globalPoolLimit;
+		// Objects taken out above are in neither pool right now, count them too.
+		auto getPoolCount = [this, ObjectClass, reusedCount]()
+		{
+			const auto liveObjects = PoolingLiveObjectMap.Find(ObjectClass);
+			const auto dormantObjects = PoolingDormantObjectMap.Find(ObjectClass);
+			return (liveObjects ? liveObjects->Count() : 0) + (dormantObjects ? dormantObjects->Count() : 0) + reusedCount;
+		};
+		// Stale entries may be counted, only pay for a full clean up when the limit seems reached.
+		if (getPoolCount() + Count - reusedCount > PoolLimit)
+			CleanUpPools(ObjectClass);
+		const int32 toCreate = FMath::Clamp(PoolLimit - getPoolCount(), 0, Count - reusedCount);
+		limitRefusedCount = Count - reusedCount - toCreate;
+		for (int32 i = 0; i < toCreate; i++)
+		{
+			UObject* newObject = CreateNewObject(ObjectClass, Owner);
+			if (!newObject)
+			{
+				UE_LOG(LogPulseObjectPooling, Error, TEXT("Cannot QueryObjects: Unable to create new object of type %s"), *Class->GetName());
+				break;
+			}
+			Outputs.Add(newObject);
+		}
+	}
+	const int32 createdCount = Outputs.Num() - reusedCount;
+
+	// Move everything to the live pool at once.
+	if (Outputs.Num() > 0)
+	{
+		auto& liveObjects = PoolingLiveObjectMap.FindOrAdd(ObjectClass);
+		for (UObject* obj : Outputs)
+			liveObjects.Add(obj);
+		_poolStats.FindOrAdd(ObjectClass).RecordLiveCount(liveObjects.Count());
+	}
+	if (const auto dormantObjects = PoolingDormantObjectMap.Find(ObjectClass); dormantObjects && !dormantObjects->IsValid())
+	{
+		PoolingDormantObjectMap.Remove(ObjectClass);
+		OnPoolCleared.Broadcast(ObjectClass);
+	}
+
+	// Activate the objects. Those refused are sent back to the pool.
+	auto OwningActor = Cast<AActor>(Owner);
+	int32 refusedCount = 0;
+	for (int32 i = 0; i < Outputs.Num(); i++)
+	{
+		UObject* obj = Outputs[i];
+		if (auto asActor = Cast<AActor>(obj))
+		{
+			SetPooledActorDormant_Internal(asActor, false);
+		}
+		else if (auto asComponent = Cast<UActorComponent>(obj))
+		{
+			if (OwningActor && !UPulseSystemLibrary::AddComponentAtRuntime(OwningActor, asComponent))
+			{
+				DisposeObject_Internal(obj);
+				Outputs[i] = nullptr;
+				refusedCount++;
+				continue;
+			}
+		}
+		if (OwningActor)
+		{
+			_linkedPoolObjectActors.FindOrAdd(OwningActor).Add(obj);
+			_pooledObjectOwners.Add(FObjectKey(obj), OwningActor);
+		}
+		const FPoolingParamsView params = GetParams(i);
+		if (params.IsValid() && obj->Implements<UIPulsePoolableObject>() && !IIPulsePoolableObject::DispatchPoolQuery(obj, params))
+		{
+			DisposeObject_Internal(obj);
+			Outputs[i] = nullptr;
+			refusedCount++;
+		}
+	}
+	if (OwningActor)
+	{
+		if (const auto linkedObjects = _linkedPoolObjectActors.Find(OwningActor); linkedObjects && linkedObjects->IsValid())
+			OwningActor->OnDestroyed.AddUniqueDynamic(this, &UPulseObjectPooling::OnDestroyLinkedActor_Internal);
+	}
+	// Only objects actually handed out count as hits or misses, the reused ones come first.
+	auto& classStats = _poolStats.FindOrAdd(ObjectClass);
+	for (int32 i = 0; i < Outputs.Num(); i++)
+	{
+		if (!Outputs[i])
+			continue;
+		if (i < reusedCount)
+			classStats.Hits++;
+		else
+			classStats.Misses++;
+	}
+	classStats.LimitRefusals += limitRefusedCount;
+	if (refusedCount > 0)
+	{
+		UE_LOG(LogPulseObjectPooling, Warning, TEXT("QueryObjects: %d objects of type %s refused their query params"), refusedCount, *Class->GetName());
+		Outputs.RemoveAll([](const UObject* obj) { return obj == nullptr; });
+	}
+
+	if (Outputs.Num() > 0)
+	{
+		classStats.RecordAcquire(FPlatformTime::Seconds() - queryStart, Outputs.Num());
+		OnPoolBatchQuery.Broadcast(ObjectClass, reusedCount, createdCount);
+	}
+	UE_LOG(LogPulseObjectPooling, Verbose, TEXT("QueryObjects %d/%d objects of type %s"), Outputs.Num(), Count, *Class->GetName());
+	if (Outputs.Num() >= Count)
+		return EPoolQueryResult::Success;
+	return refusedCount > 0 ? EPoolQueryResult::InvalidParams : EPoolQueryResult::PoolLimitReached;
+}
+
 void UPulseObjectPooling::RegisterExistingObjectToPool(UObject*& Object)
 {
 	if (!Object)
@@ -437,20 +827,124 @@ void UPulseObjectPooling::PreFillPool(TArray<TSubclassOf<UClass>> ObjectClasses,
 		return;
 	for (auto classPtr : workingClasses)
 	{
-		int32 PoolLimit = PerClassPoolLimit.Contains(classPtr) ? PerClassPoolLimit[classPtr] : _globalPoolLimit;
-		int32 DormantCount = PoolingDormantObjectMap.Contains(classPtr) ? PoolingDormantObjectMap[classPtr].Count() : 0;
-		int32 maxCount = FMath::Min(FMath::Max(PoolLimit - DormantCount, 0), CountPerObject); // Ensure we don't try to preload more than the limit.
+		int32 maxCount = FMath::Min(GetPreFillRoom_Internal(classPtr), CountPerObject); // Ensure we don't try to preload more than the limit.
 		if (maxCount <= 0)
 			continue; // If the pool is already full, we don't need to preload anything.
 		for (int32 i = 0; i < maxCount; i++)
+			PreFillOne_Internal(classPtr);
+	}
+}
+
+int32 UPulseObjectPooling::GetPreFillRoom_Internal(TSubclassOf<UObject> Class) const
+{
+	const int32* classLimit = PerClassPoolLimit.Find(Class);
+	const auto dormantObjects = PoolingDormantObjectMap.Find(Class);
+	const int32 PoolLimit = classLimit ? *classLimit : _globalPoolLimit;
+	const int32 DormantCount = dormantObjects ? dormantObjects->Count() : 0;
+	return FMath::Max(PoolLimit - DormantCount, 0);
+}
+
+void UPulseObjectPooling::PreFillOne_Internal(TSubclassOf<UObject> Class)
+{
+	UObject* Object = CreateNewObject(Class);
+	if (!Object)
+		return;
+	RegisterExistingObjectToPool(Object);
+	DisposeObject_Internal(Object);
+}
+
+void UPulseObjectPooling::ProcessPreFillJobs_Internal()
+{
+	if (_preFillJobs.IsEmpty())
+		return;
+	TRACE_CPUPROFILER_EVENT_SCOPE(PulseObjectPooling::PreFill);
+	TArray<TTuple<FGuid, int32, int32>> progressedJobs;
+	TArray<FGuid> completedJobs;
+	const double frameStart = FPlatformTime::Seconds();
+	int32 spawnedThisFrame = 0;
+	// Jobs are served in order, sharing this frame's budget. The first job always creates at least one object.
+	while (!_preFillJobs.IsEmpty())
+	{
+		// Take the job out while working on it: object callbacks may start or cancel other pre-fills.
+		FPoolPreFillJob job = MoveTemp(_preFillJobs[0]);
+		_preFillJobs.RemoveAt(0);
+		const int32 filledBefore = job.FilledCount;
+		while (!job.IsDone())
 		{
-			UObject* Object = CreateNewObject(classPtr);
-			if (!Object)
+			const bool timeOut = job.FrameBudgetMs > 0 && (FPlatformTime::Seconds() - frameStart) * 1000.0 >= job.FrameBudgetMs;
+			const bool countOut = job.MaxSpawnPerFrame > 0 && spawnedThisFrame >= job.MaxSpawnPerFrame;
+			if (spawnedThisFrame > 0 && (timeOut || countOut))
+				break;
+			const auto classPtr = job.Classes[job.ClassIndex];
+			// The pool may have been filled by other means since the job started.
+			if (job.RemainingCounts[job.ClassIndex] <= 0 || GetPreFillRoom_Internal(classPtr) <= 0)
+			{
+				job.FilledCount += FMath::Max(job.RemainingCounts[job.ClassIndex], 0);
+				job.RemainingCounts[job.ClassIndex] = 0;
+				job.ClassIndex++;
 				continue;
-			RegisterExistingObjectToPool(Object);
-			DisposeObject_Internal(Object);
+			}
+			PreFillOne_Internal(classPtr);
+			job.RemainingCounts[job.ClassIndex]--;
+			job.FilledCount++;
+			spawnedThisFrame++;
 		}
+		if (job.FilledCount != filledBefore)
+			progressedJobs.Add(MakeTuple(job.JobID, job.FilledCount, job.TotalCount));
+		if (!job.IsDone())
+		{
+			_preFillJobs.Insert(MoveTemp(job), 0);
+			break;
+		}
+		completedJobs.Add(job.JobID);
+	}
+	for (const auto& progress : progressedJobs)
+		OnPoolPreFillProgress.Broadcast(progress.Get<0>(), progress.Get<1>(), progress.Get<2>());
+	for (const auto& jobID : completedJobs)
+	{
+		UE_LOG(LogPulseObjectPooling, Log, TEXT("Pool pre-fill %s completed"), *jobID.ToString());
+		OnPoolPreFillCompleted.Broadcast(jobID, false);
+	}
+}
+
+FGuid UPulseObjectPooling::PreFillPoolAsync(TArray<TSubclassOf<UObject>> ObjectClasses, int32 CountPerObject, float FrameBudgetMs, int32 MaxSpawnPerFrame)
+{
+	FPoolPreFillJob job;
+	for (auto classPtr : ObjectClasses)
+	{
+		if (!classPtr || job.Classes.Contains(classPtr))
+			continue;
+		const int32 count = FMath::Min(GetPreFillRoom_Internal(classPtr), CountPerObject);
+		if (count <= 0)
+			continue;
+		job.Classes.Add(classPtr);
+		job.RemainingCounts.Add(count);
+		job.TotalCount += count;
 	}
+	if (job.TotalCount <= 0)
+		return FGuid();
+	job.JobID = FGuid::NewGuid();
+	job.FrameBudgetMs = FrameBudgetMs < 0 ? _preFillFrameBudgetMs : FrameBudgetMs;
+	job.MaxSpawnPerFrame = MaxSpawnPerFrame < 0 ? _preFillMaxSpawnPerFrame : MaxSpawnPerFrame;
+	_preFillJobs.Add(job);
+	UE_LOG(LogPulseObjectPooling, Log, TEXT("Pool pre-fill %s started for %d objects"), *job.JobID.ToString(), job.TotalCount);
+	return job.JobID;
+}
+
+bool UPulseObjectPooling::CancelPreFillPool(const FGuid& JobID)
+{
+	const int32 index = _preFillJobs.IndexOfByPredicate([&JobID](const FPoolPreFillJob& Job) { return Job.JobID == JobID; });
+	if (index == INDEX_NONE)
+		return false;
+	_preFillJobs.RemoveAt(index);
+	UE_LOG(LogPulseObjectPooling, Log, TEXT("Pool pre-fill %s cancelled"), *JobID.ToString());
+	OnPoolPreFillCompleted.Broadcast(JobID, true);
+	return true;
+}
+
+bool UPulseObjectPooling::IsPreFillingPool(const FGuid& JobID) const
+{
+	return _preFillJobs.ContainsByPredicate([&JobID](const FPoolPreFillJob& Job) { return Job.JobID == JobID; });
 }
 
 EPoolQueryResult UPulseObjectPooling::DisposeObject(UObject* Object)
@@ -461,6 +955,126 @@ EPoolQueryResult UPulseObjectPooling::DisposeObject(UObject* Object)
 	return res;
 }
 
+int32 UPulseObjectPooling::DisposeObjects(const TArray<UObject*>& Objects)
+{
+	return DisposeObjects(TArrayView<UObject* const>(Objects));
+}
+
+int32 UPulseObjectPooling::DisposeObjects(TArrayView<UObject* const> Objects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PulseObjectPooling::DisposeObjects);
+	int32 disposedCount = 0;
+	// Objects are handled in runs of the same class, so the class bookkeeping is done once per run.
+	int32 runStart = 0;
+	while (runStart < Objects.Num())
+	{
+		UClass* runClass = Objects[runStart] ? Objects[runStart]->GetClass() : nullptr;
+		int32 runEnd = runStart + 1;
+		while (runEnd < Objects.Num() && Objects[runEnd] && Objects[runEnd]->GetClass() == runClass)
+			runEnd++;
+		if (!runClass)
+		{
+			UE_LOG(LogPulseObjectPooling, Error, TEXT("Cannot Dispose: Object is null"));
+		}
+		else if (const int32 runDisposed = DisposeObjectRun_Internal(runClass, Objects.Slice(runStart, runEnd - runStart)))
+		{
+			disposedCount += runDisposed;
+			OnPoolBatchDisposed.Broadcast(runClass, runDisposed);
+		}
+		runStart = runEnd;
+	}
+	return disposedCount;
+}
+
+int32 UPulseObjectPooling::DisposeObjectRun_Internal(UClass* Class, TArrayView<UObject* const> Objects)
+{
+	const auto liveObjects = PoolingLiveObjectMap.Find(Class);
+	if (!liveObjects)
+	{
+		UE_LOG(LogPulseObjectPooling, Error, TEXT("Cannot Dispose Objects: Class %s not present in the live pool"), *Class->GetName());
+		return 0;
+	}
+	// Objects leave the live pool right away, which also filters duplicates out.
+	TArray<UObject*, TInlineAllocator<32>> disposing;
+	disposing.Reserve(Objects.Num());
+	for (UObject* obj : Objects)
+	{
+		if (liveObjects->Remove(obj))
+		{
+			disposing.Add(obj);
+			continue;
+		}
+		UE_LOG(LogPulseObjectPooling, Error, TEXT("Cannot Dispose Object %s (%s): doesn't belong to the live pool"), *GetNameSafe(obj), *GetNameSafe(obj ? obj->GetOuter() : nullptr));
+	}
+
+	// Put the objects to sleep.
+	for (int32 i = disposing.Num() - 1; i >= 0; i--)
+	{
+		UObject* obj = disposing[i];
+		if (obj->Implements<UIPulsePoolableObject>())
+			IIPulsePoolableObject::Execute_OnPoolDispose(obj);
+		if (auto asActor = Cast<AActor>(obj))
+		{
+			SetPooledActorDormant_Internal(asActor, true);
+		}
+		else if (auto asComponent = Cast<UActorComponent>(obj))
+		{
+			if (!UPulseSystemLibrary::RemoveComponentAtRuntime(asComponent->GetOwner(), asComponent))
+			{
+				// Can't take it from its owner, it stays live.
+				PoolingLiveObjectMap.FindOrAdd(Class).Add(obj);
+				disposing.RemoveAtSwap(i, 1, EAllowShrinking::No);
+				continue;
+			}
+		}
+		UnlinkObjectFromOwner_Internal(obj);
+	}
+	if (const auto liveSet = PoolingLiveObjectMap.Find(Class); liveSet && !liveSet->IsValid())
+	{
+		PoolingLiveObjectMap.Remove(Class);
+		OnPoolCleared.Broadcast(Class);
+	}
+	if (disposing.IsEmpty())
+		return 0;
+
+	// Keep as many as the dormant pool has room for, destroy the others.
+	const int32* classLimit = PerClassPoolLimit.Find(Class);
+	const int32 PoolLimit = classLimit ? *classLimit : _globalPoolLimit;
+	auto getDormantCount = [this, Class]()
+	{
+		const auto dormantObjects = PoolingDormantObjectMap.Find(Class);
+		return dormantObjects ? dormantObjects->Count() : 0;
+	};
+	// Stale entries may be counted, only pay for a full clean up when the limit seems reached.
+	if (getDormantCount() + disposing.Num() > PoolLimit)
+		CleanUpPools(Class);
+	const int32 keptCount = FMath::Clamp(PoolLimit - getDormantCount(), 0, disposing.Num());
+	if (keptCount > 0)
+	{
+		auto& dormantObjects = PoolingDormantObjectMap.FindOrAdd(Class);
+		for (int32 i = 0; i < keptCount; i++)
+			dormantObjects.Add(disposing[i]);
+		_poolStats.FindOrAdd(Class).RecordDormantCount(dormantObjects.Count());
+	}
+	for (int32 i = keptCount; i < disposing.Num(); i++)
+	{
+		if (auto asActor = Cast<AActor>(disposing[i]))
+		{
+			_actorDormancy.Remove(FObjectKey(asActor));
+			asActor->Destroy();
+		}
+		else if (auto asComponent = Cast<UActorComponent>(disposing[i]))
+		{
+			asComponent->ConditionalBeginDestroy();
+		}
+	}
+	if (keptCount < disposing.Num())
+		_poolStats.FindOrAdd(Class).Evictions += disposing.Num() - keptCount;
+
+	UE_LOG(LogPulseObjectPooling, Verbose, TEXT("Disposed %d objects of type %s"), disposing.Num(), *Class->GetName());
+	return disposing.Num();
+}
+
 void UPulseObjectPooling::ClearPoolType(TSubclassOf<UObject> ObjectClass)
 {
 	if (!ObjectClass)
@@ -477,6 +1091,10 @@ void UPulseObjectPooling::ClearPoolType(TSubclassOf<UObject> ObjectClass)
 	if (PoolingDormantObjectMap.Contains(ObjectClass))
 	{
 		// Destroy all dormant object of this type
+		PoolingDormantObjectMap[ObjectClass].ForAllValid([this](UObject* Object)
+		{
+			_actorDormancy.Remove(FObjectKey(Object));
+		});
 		PoolingDormantObjectMap[ObjectClass].Clean(true);
 		// Clear the dormant pool for this object class.
 		PoolingDormantObjectMap.Remove(ObjectClass);
@@ -591,6 +1209,14 @@ void UPulseObjectPooling::GetPoolClasses(TMap<TSubclassOf<UObject>, int32>& OutC
 	}
 }
 
+bool UPulseObjectPooling::IsPooledActorDormant(const AActor* Actor) const
+{
+	if (!Actor)
+		return false;
+	const auto dormancy = _actorDormancy.Find(FObjectKey(Actor));
+	return dormancy && dormancy->bDormant;
+}
+
 void UPulseObjectPooling::GetPoolClassCount(TSubclassOf<UObject> Class, int32& OutActiveCount, int32& OutInactiveCount)
 {
 	OutActiveCount = 0;
@@ -648,6 +1274,22 @@ void UPulseObjectPooling::DebugPoolingSystem(const UObject* WorldContext, FLinea
 					text.Append(FString::Printf(TEXT("\t\t[%s Requested %d Objects]\n"), *key->GetFName().ToString(), item.Value.Count()));
 			}
 		}
+		text.Append(FString::Printf(TEXT("\n\tStatistics%s:\n"), PoolingSystem->_bAdaptivePoolSizing ? TEXT(" (Adaptive)") : TEXT("")));
+		if (PoolingSystem->_poolStats.IsEmpty())
+		{
+			text.Append(TEXT("\t\t[Empty]\n"));
+		}
+		else
+		{
+			for (const auto& item : PoolingSystem->_poolStats)
+			{
+				if (!item.Key)
+					continue;
+				const auto& stats = item.Value;
+				text.Append(FString::Printf(TEXT("\t\t[%s: %d hits, %d misses, %d refused by limit, %d created, %d evicted, peak %d live / %d dormant, %.1fus per query]\n"), *item.Key->GetName(),
+				                            stats.Hits, stats.Misses, stats.LimitRefusals, stats.Creations, stats.Evictions, stats.PeakLive, stats.PeakDormant, stats.AverageAcquireMicroseconds));
+			}
+		}
 		text.Append(TEXT("\n"));
 		UKismetSystemLibrary::PrintString(WorldContext, text, true, Log, TextColor, Duration, Key);
 	}
@@ -2,6 +2,8 @@
 
 
 #include "ObjectPooling/PulsePoolingTypes.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
 
 
 bool FPoolingParams::IsValid() const
@@ -24,3 +26,236 @@ bool FPoolingParams::IsValid() const
 		return true;
 	return false;
 }
+
+
+FPoolingParamsView::FPoolingParamsView(const FPoolingParams& Params)
+	: TransformParams(Params.TransformParams)
+	  , VectorParams(Params.VectorParams)
+	  , ColorParams(Params.ColorParams)
+	  , RotationParams(Params.RotationParams)
+	  , ValueParams(Params.ValueParams)
+	  , AssetParams(Params.AssetParams)
+	  , NamesParams(Params.NamesParams)
+	  , CustomParams(Params.CustomParams)
+	  , Source(&Params)
+{
+}
+
+FPoolingParamsView::FPoolingParamsView(const FTransform& SpawnTransform)
+	: TransformParams(&SpawnTransform, 1)
+{
+}
+
+bool FPoolingParamsView::IsValid() const
+{
+	return !TransformParams.IsEmpty() || !VectorParams.IsEmpty() || !ColorParams.IsEmpty() || !RotationParams.IsEmpty()
+		|| !ValueParams.IsEmpty() || !AssetParams.IsEmpty() || !NamesParams.IsEmpty() || !CustomParams.IsEmpty();
+}
+
+void FPoolingParamsView::ToParams(FPoolingParams& OutParams) const
+{
+	auto copyTo = [](auto& Out, const auto& View)
+	{
+		Out.Reset(View.Num());
+		Out.Append(View.GetData(), View.Num());
+	};
+	copyTo(OutParams.TransformParams, TransformParams);
+	copyTo(OutParams.VectorParams, VectorParams);
+	copyTo(OutParams.ColorParams, ColorParams);
+	copyTo(OutParams.RotationParams, RotationParams);
+	copyTo(OutParams.ValueParams, ValueParams);
+	copyTo(OutParams.AssetParams, AssetParams);
+	copyTo(OutParams.NamesParams, NamesParams);
+	copyTo(OutParams.CustomParams, CustomParams);
+}
+
+
+void FPoolingTypeObjects::RemoveAtSlot(int32 Index)
+{
+	SlotIndexes.Remove(ObjectKeys[Index]);
+	ObjectSet.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ObjectKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	// The last object now sits in the freed slot, update its index.
+	if (ObjectKeys.IsValidIndex(Index))
+		SlotIndexes.Add(ObjectKeys[Index], Index);
+}
+
+bool FPoolingTypeObjects::Add(UObject* obj)
+{
+	if (!obj)
+		return false;
+	const FObjectKey key(obj);
+	if (SlotIndexes.Contains(key))
+		return false;
+	SlotIndexes.Add(key, ObjectSet.Add(obj));
+	ObjectKeys.Add(key);
+	return true;
+}
+
+bool FPoolingTypeObjects::Remove(UObject* obj)
+{
+	if (!obj)
+		return false;
+	const int32* index = SlotIndexes.Find(FObjectKey(obj));
+	if (!index)
+		return false;
+	RemoveAtSlot(*index);
+	return true;
+}
+
+bool FPoolingTypeObjects::Replace(UObject* Old, UObject* New, bool bAddIfNotExist)
+{
+	if (!Contains(Old))
+	{
+		if (!bAddIfNotExist)
+			return false;
+		return Add(New);
+	}
+	Remove(Old);
+	if (New)
+		Add(New);
+	return true;
+}
+
+UObject* FPoolingTypeObjects::TrimInvalidLast()
+{
+	while (!ObjectSet.IsEmpty())
+	{
+		UObject* obj = ObjectSet.Last().Get();
+		if (::IsValid(obj))
+			return obj;
+		RemoveAtSlot(ObjectSet.Num() - 1);
+	}
+	return nullptr;
+}
+
+bool FPoolingTypeObjects::CleanStep(int32& Budget)
+{
+	while (Budget > 0 && SweepCursor < ObjectSet.Num())
+	{
+		Budget--;
+		if (::IsValid(ObjectSet[SweepCursor].Get()))
+			SweepCursor++;
+		else
+			RemoveAtSlot(SweepCursor); // The swapped-in object is checked next, at the same slot.
+	}
+	if (SweepCursor < ObjectSet.Num())
+		return false;
+	SweepCursor = 0;
+	return true;
+}
+
+void FPoolingTypeObjects::Clean(bool bDestroy)
+{
+	if (bDestroy)
+	{
+		const auto array = ObjectSet;
+		ObjectSet.Empty();
+		ObjectKeys.Empty();
+		SlotIndexes.Empty();
+		SweepCursor = 0;
+		for (auto obj : array)
+		{
+			if (!obj)
+				continue;
+			if (auto asActor = Cast<AActor>(obj))
+				asActor->Destroy();
+			else if (auto asComponent = Cast<UActorComponent>(obj))
+				asComponent->ConditionalBeginDestroy();
+			else
+				obj->MarkAsGarbage();
+		}
+		return;
+	}
+
+	for (int32 i = ObjectSet.Num() - 1; i >= 0; i--)
+	{
+		if (!::IsValid(ObjectSet[i].Get()))
+			RemoveAtSlot(i);
+	}
+	SweepCursor = 0;
+}
+
+
+void FPooledActorDormancy::Refresh(const AActor* Actor)
+{
+	Primitives.Reset();
+	ComponentCount = -1;
+	if (!Actor)
+		return;
+	const auto& components = Actor->GetComponents();
+	ComponentCount = components.Num();
+	for (auto comp : components)
+	{
+		if (auto primComp = Cast<UPrimitiveComponent>(comp))
+			Primitives.Add(primComp);
+	}
+}
+
+bool FPooledActorDormancy::SetDormant(AActor* Actor, bool bNewDormant, bool bManageNetDormancy)
+{
+	if (!Actor)
+		return false;
+	if (Actor->GetComponents().Num() != ComponentCount)
+		Refresh(Actor);
+	if (bDormant == bNewDormant)
+		return false;
+	bDormant = bNewDormant;
+	// Render state changes are only marked dirty here, and sent all at once in the end of frame update.
+	Actor->SetActorHiddenInGame(bNewDormant);
+	Actor->SetActorTickEnabled(!bNewDormant);
+	Actor->SetActorEnableCollision(!bNewDormant);
+	if (bNewDormant)
+	{
+		SuspendedSimulations.Reset();
+		for (const auto& primComp : Primitives)
+		{
+			if (primComp.IsValid() && primComp->IsSimulatingPhysics())
+			{
+				primComp->SetSimulatePhysics(false);
+				SuspendedSimulations.Add(primComp);
+			}
+		}
+	}
+	else
+	{
+		for (const auto& primComp : SuspendedSimulations)
+		{
+			if (primComp.IsValid())
+				primComp->SetSimulatePhysics(true);
+		}
+		SuspendedSimulations.Reset();
+		// Reused actors start at rest, as EnableActor does.
+		for (const auto& primComp : Primitives)
+		{
+			if (!primComp.IsValid())
+				continue;
+			primComp->SetPhysicsLinearVelocity(FVector::ZeroVector, false);
+			primComp->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector, false);
+		}
+	}
+	if (bNewDormant && bManageNetDormancy && Actor->GetIsReplicated() && Actor->HasAuthority())
+	{
+		// The channel replicates pending changes (the hidden state) before going dormant.
+		// Read before the net update, which turns an initial dormancy into DormantAll.
+		RestoreNetDormancy = Actor->NetDormancy;
+		Actor->ForceNetUpdate();
+		Actor->SetNetDormancy(DORM_DormantAll);
+		bNetDormant = true;
+	}
+	else if (!bNewDormant)
+	{
+		if (bNetDormant)
+		{
+			// Back to the actor's own net dormancy. An initial dormancy only holds until the channel opens, which it already did.
+			Actor->SetNetDormancy(RestoreNetDormancy == DORM_Initial ? DORM_DormantAll : RestoreNetDormancy.GetValue());
+			// An actor dormant by design stays so, its wake up must still be sent once.
+			Actor->FlushNetDormancy();
+			bNetDormant = false;
+		}
+		// Reuse should reach clients without waiting for the next relevancy update.
+		if (Actor->GetIsReplicated() && Actor->HasAuthority())
+			Actor->ForceNetUpdate();
+	}
+	return true;
+}
@@ -7,6 +7,111 @@
 #include "Kismet/GameplayStatics.h"
 #include "Async/ParallelFor.h"
 #include "Core/PulseSystemLibrary.h"
+#include "Components/SceneComponent.h"
+#include "Components/Widget.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Curves/CurveFloat.h"
+
+
+namespace PulseTweenTargets
+{
+	// Resolve a dot separated property path from an object class down to a supported value property.
+	bool ResolvePropertyChain(const UObject* Object, const FString& Path, TArray<FProperty*, TInlineAllocator<4>>& OutChain)
+	{
+		TArray<FString> names;
+		Path.ParseIntoArray(names, TEXT("."));
+		const UStruct* container = Object->GetClass();
+		for (int32 i = 0; i < names.Num(); i++)
+		{
+			FProperty* property = FindFProperty<FProperty>(container, *names[i]);
+			if (!property)
+				return false;
+			OutChain.Add(property);
+			if (i == names.Num() - 1)
+				break;
+			const FStructProperty* structProperty = CastField<FStructProperty>(property);
+			if (!structProperty)
+				return false;
+			container = structProperty->Struct;
+		}
+		if (OutChain.IsEmpty())
+			return false;
+		const FProperty* leaf = OutChain.Last();
+		if (leaf->IsA<FFloatProperty>() || leaf->IsA<FDoubleProperty>())
+			return true;
+		const FStructProperty* leafStruct = CastField<FStructProperty>(leaf);
+		return leafStruct && (leafStruct->Struct == TBaseStructure<FVector>::Get() || leafStruct->Struct == TBaseStructure<FVector2D>::Get()
+			|| leafStruct->Struct == TBaseStructure<FRotator>::Get() || leafStruct->Struct == TBaseStructure<FLinearColor>::Get());
+	}
+
+	void WriteProperty(UObject* Object, const TArray<FProperty*, TInlineAllocator<4>>& Chain, const FVector4& Value)
+	{
+		void* address = Object;
+		for (const FProperty* property : Chain)
+			address = property->ContainerPtrToValuePtr<void>(address);
+		const FProperty* leaf = Chain.Last();
+		if (const FFloatProperty* floatProperty = CastField<FFloatProperty>(leaf))
+		{
+			floatProperty->SetPropertyValue(address, Value.X);
+			return;
+		}
+		if (const FDoubleProperty* doubleProperty = CastField<FDoubleProperty>(leaf))
+		{
+			doubleProperty->SetPropertyValue(address, Value.X);
+			return;
+		}
+		const UScriptStruct* valueStruct = CastFieldChecked<const FStructProperty>(leaf)->Struct;
+		if (valueStruct == TBaseStructure<FVector>::Get())
+			*static_cast<FVector*>(address) = FVector(Value);
+		else if (valueStruct == TBaseStructure<FVector2D>::Get())
+			*static_cast<FVector2D*>(address) = FVector2D(Value.X, Value.Y);
+		else if (valueStruct == TBaseStructure<FRotator>::Get())
+			*static_cast<FRotator*>(address) = FRotator(Value.X, Value.Y, Value.Z);
+		else if (valueStruct == TBaseStructure<FLinearColor>::Get())
+			*static_cast<FLinearColor*>(address) = FLinearColor(Value);
+	}
+
+	// Write a tween value to a target. The object was checked against the target type when the target was bound.
+	void Apply(const FPulseTweenTargetBinding& Binding, UObject* Object, float Alpha)
+	{
+		const FPulseTweenTarget& target = Binding.Target;
+		switch (target.Type)
+		{
+		default:
+			break;
+		case EPulseTweenTargetType::ActorTransform:
+			static_cast<AActor*>(Object)->SetActorTransform(target.LerpTransform(Alpha));
+			break;
+		case EPulseTweenTargetType::ComponentTransform:
+			static_cast<USceneComponent*>(Object)->SetWorldTransform(target.LerpTransform(Alpha));
+			break;
+		case EPulseTweenTargetType::RelativeLocation:
+			static_cast<USceneComponent*>(Object)->SetRelativeLocation(FVector(target.LerpValue(Alpha)));
+			break;
+		case EPulseTweenTargetType::MaterialScalar:
+			static_cast<UMaterialInstanceDynamic*>(Object)->SetScalarParameterByIndex(Binding.ParameterIndex, target.LerpValue(Alpha).X);
+			break;
+		case EPulseTweenTargetType::MaterialVector:
+			static_cast<UMaterialInstanceDynamic*>(Object)->SetVectorParameterByIndex(Binding.ParameterIndex, FLinearColor(target.LerpValue(Alpha)));
+			break;
+		case EPulseTweenTargetType::WidgetOpacity:
+			static_cast<UWidget*>(Object)->SetRenderOpacity(target.LerpValue(Alpha).X);
+			break;
+		case EPulseTweenTargetType::WidgetTransform:
+			{
+				const FVector translation = FMath::Lerp(target.FromTransform.GetLocation(), target.ToTransform.GetLocation(), Alpha);
+				const FVector scale = FMath::Lerp(target.FromTransform.GetScale3D(), target.ToTransform.GetScale3D(), Alpha);
+				const float angle = target.LerpValue(Alpha).X;
+				static_cast<UWidget*>(Object)->SetRenderTransform(FWidgetTransform(FVector2D(translation.X, translation.Y), FVector2D(scale.X, scale.Y), FVector2D::ZeroVector, angle));
+			}
+			break;
+		case EPulseTweenTargetType::Property:
+			WriteProperty(Object, Binding.PropertyChain, target.LerpValue(Alpha));
+			break;
+		}
+	}
+}
 
 
 void UPulseTween::BeginDestroy()
@@ -21,11 +126,31 @@ void UPulseTween::BeginDestroy()
 	_pingPongApexSet.Empty();
 	_loopSet.Empty();
 	_sequenceCompletedSet.Empty();
-	_sequenceChkSet.Empty();
 	_sequenceMoveNextSet.Empty();
-	_tweenInstanceIndexesMap.Empty();
+	_tweenSubscribers.Empty();
+	_pendingTweenEvents.Empty();
+	_tweenHandles.Empty();
+	_tweenSlots.Empty();
 	_tweenStatusChangeRequest.Empty();
-	_tweenInstances.Empty();
+	_tweenTimings.Empty();
+	_tweenColdData.Empty();
+	_tweenValues.Empty();
+	for (FPulseTweenTargetBatch& batch : _targetBatches)
+		batch.Bindings.Empty();
+	_newTweenTargets.Empty();
+	_easeTables.Empty();
+	_curveTables.Empty();
+	_curveTableIndexes.Empty();
+	_tweenGroups.Empty();
+	_tweenGroupIndexes.Empty();
+	for (int32 i = _tweenOwners.Num() - 1; i >= 0; i--)
+		RemoveTweenOwnerAt_Internal(i);
+	_endedOwners.Empty();
+	_ActiveSequences.Empty();
+	_sequenceIndexes.Empty();
+	_stepSequenceIDs.Empty();
+	_sequenceStepTimings.Empty();
+	_sequenceStepColdData.Empty();
 }
 
 void UPulseTween::Deinitialize()
@@ -46,9 +171,11 @@ ETickableTickType UPulseTween::GetTickableTickType() const
 void UPulseTween::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	FindOrAddTweenGroup_Internal(NAME_None);
 	if (auto config = GetProjectSettings())
 	{
 		_tweenCountMT = config->bUseMultiThreadedTween ? config->TweenCountToMultiThreadProcessing : -1;
+		SetEaseLookupTables(config->bUseEaseLookupTables, config->EaseLookupTableSamples);
 	}
 	UE_LOG(LogPulseTweening, Log, TEXT("Tweening sub-system initialized"));
 }
@@ -90,8 +217,11 @@ void UPulseTween::Tick(float DeltaTime)
 		_pingPongApexSet.Reset();
 		_loopSet.Reset();
 		_sequenceCompletedSet.Reset();
-		_sequenceChkSet.Reset();
 		_sequenceMoveNextSet.Reset();
+		_reusedIndexList.Reset();
+		_pendingTweenEvents.Reset();
+		_bGlobalEventsBound = OnTweenUpdateEvent.IsBound() || OnTweenStartedEvent.IsBound() || OnTweenPausedEvent.IsBound() || OnTweenResumedEvent.IsBound()
+			|| OnTweenCompletedEvent.IsBound() || OnTweenCancelledEvent.IsBound() || OnTweenPingPongApexEvent.IsBound() || OnTweenLoopEvent.IsBound();
 	}
 	// Add new ones
 	if (!_newTweensQueue.IsEmpty())
@@ -101,16 +231,11 @@ void UPulseTween::Tick(float DeltaTime)
 		while (_newTweensQueue.Dequeue(newInstance))
 		{
 			UE_LOG(LogPulseTweening, Log, TEXT("Tween %s Activated"), *newInstance.Identifier.ToString());
-			_tweenInstances.Add(newInstance);
-			// Update index map
-			for (int i = 0; i < _tweenInstances.Num(); i++)
-			{
-				if (_tweenInstanceIndexesMap.Contains(_tweenInstances[i].Identifier))
-					_tweenInstanceIndexesMap[_tweenInstances[i].Identifier] = i;
-				else
-					_tweenInstanceIndexesMap.Add(_tweenInstances[i].Identifier, i);
-			}
+			AddTween_Internal(newInstance);
 		}
+		for (const TPair<FGuid, FPulseTweenTarget>& newTarget : _newTweenTargets)
+			BindTarget_Internal(newTarget.Key, newTarget.Value);
+		_newTweenTargets.Reset();
 	}
 	// handle pause/resume/cancel requests
 	if (!_tweenStatusChangeRequest.IsEmpty())
@@ -118,118 +243,116 @@ void UPulseTween::Tick(float DeltaTime)
 		TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Tick::ChangesRequests);
 		for (const TPair<FGuid, int>& ChangeRequest : _tweenStatusChangeRequest)
 		{
-			if (!_tweenInstanceIndexesMap.Contains(ChangeRequest.Key))
-				continue;
-			const int32 index = _tweenInstanceIndexesMap[ChangeRequest.Key];
-			if (!_tweenInstances.IsValidIndex(index))
+			const int32 index = FindTweenIndex_Internal(ChangeRequest.Key);
+			if (index == INDEX_NONE)
 				continue;
 			// Cancel
 			if (ChangeRequest.Value == 3)
 			{
-				UE_LOG(LogPulseTweening, Log, TEXT("Tween %s Cancelled"), *_tweenInstances[index].Identifier.ToString());
-				_reusedIndexQueue.Enqueue(index);
+				UE_LOG(LogPulseTweening, Log, TEXT("Tween %s Cancelled"), *ChangeRequest.Key.ToString());
+				_reusedIndexList.Add(index);
 				continue;
 			}
-			_tweenInstances[index].TweenIsPaused = ChangeRequest.Value == 1;
-			UE_LOG(LogPulseTweening, Log, TEXT("Tween %s %s"), *_tweenInstances[index].Identifier.ToString(), *FString(ChangeRequest.Value == 1? "Paused" : "Resumed"));
+			_tweenTimings[index].TweenIsPaused = ChangeRequest.Value == 1;
+			UE_LOG(LogPulseTweening, Log, TEXT("Tween %s %s"), *ChangeRequest.Key.ToString(), *FString(ChangeRequest.Value == 1? "Paused" : "Resumed"));
 			// Reset
 			if (ChangeRequest.Value == 4)
 			{
-				UE_LOG(LogPulseTweening, Log, TEXT("Tween %s Reset"), *_tweenInstances[index].Identifier.ToString());
-				_tweenInstances[index].Reset();
+				UE_LOG(LogPulseTweening, Log, TEXT("Tween %s Reset"), *ChangeRequest.Key.ToString());
+				_tweenTimings[index].Reset();
+				_tweenValues[index] = EvaluateTween_Internal(index);
 			}
 		}
 		_tweenStatusChangeRequest.Reset();
 	}
-	//Reset arrays
+	// Cancel the tweens of ended owners
+	if (!_tweenOwners.IsEmpty())
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Tick::ResetArrays);
-		_reusedIndexList.Reset();
+		TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Tick::OwnersLifetime);
+		CancelEndedOwnersTweens_Internal();
 	}
 	//Update Tween instances
-	if (_tweenInstances.Num() > 0)
+	if (_tweenTimings.Num() > 0)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Tick::UpdateTweenInstances);
-		FRWLock Lock;
+		const int32 tweenCount = _tweenTimings.Num();
 		// Single Thread
-		if (_tweenCountMT < _tweenInstances.Num())
+		if (_tweenCountMT < 0 || tweenCount < _tweenCountMT)
 		{
-			for (int i = _tweenInstances.Num() - 1; i >= 0; i--)
-			{
-				// Remove completed
-				if (_tweenInstances[i].IsComplete())
-				{
-					_reusedIndexQueue.Enqueue(i);
-					continue;
-				}
-				// Update instances
-				_tweenInstances[i].Update(DeltaTime, timeDilation, isPaused);
-				//Per Status Set
-				AddToStatusSet(_tweenInstances[i], Lock);
-			}
+			if (_tickBuffers.IsEmpty())
+				_tickBuffers.SetNum(1);
+			FPulseTweenTickBuffer& buffer = _tickBuffers[0];
+			buffer.Reset();
+			UpdateTweenRange_Internal(0, tweenCount, DeltaTime, timeDilation, isPaused, buffer);
+			_reusedIndexList.Append(buffer.Removed);
+			for (const int32 index : buffer.Events)
+				AddToStatusSet(index);
 		}
 		// Multi thread
 		else
 		{
-			ParallelFor(_tweenInstances.Num(), [&](int32 Index)
+			// Each task updates a chunk and records its results in its own buffer. Buffers are merged after the join, no lock needed.
+			const int32 chunkCount = FMath::DivideAndRoundUp(tweenCount, TweenUpdateChunkSize);
+			if (_tickBuffers.Num() < chunkCount)
+				_tickBuffers.SetNum(chunkCount);
+			ParallelFor(chunkCount, [&](int32 ChunkIndex)
 			{
-				FPulseTweenInstance& V = _tweenInstances[Index];
-				// Remove completed
-				if (V.IsComplete())
-				{
-					_reusedIndexQueue.Enqueue(Index);
-					return;
-				}
-				// Update instances
-				V.Update(DeltaTime, timeDilation, isPaused);
-				//Per Status Set
-				AddToStatusSet(V, Lock);
+				TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Tick::UpdateTweenChunk);
+				FPulseTweenTickBuffer& buffer = _tickBuffers[ChunkIndex];
+				buffer.Reset();
+				UpdateTweenRange_Internal(ChunkIndex * TweenUpdateChunkSize, FMath::Min((ChunkIndex + 1) * TweenUpdateChunkSize, tweenCount), DeltaTime, timeDilation,
+				                          isPaused, buffer);
 			});
+			TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Tick::MergeTweenChunks);
+			for (int32 c = 0; c < chunkCount; c++)
+			{
+				_reusedIndexList.Append(_tickBuffers[c].Removed);
+				for (const int32 index : _tickBuffers[c].Events)
+					AddToStatusSet(index);
+			}
 		}
 	}
 	// Remove instances
-	if (!_reusedIndexQueue.IsEmpty())
+	if (!_reusedIndexList.IsEmpty())
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Tick::RemovesInstances);
 		int32 index = INDEX_NONE;
-		while (_reusedIndexQueue.Dequeue(index))
-		{
-			if (index != INDEX_NONE)
-				_reusedIndexList.Add(index);
-		}
+		// Remove from the highest index down: the last instance swapped into a removed index is never one still to remove.
 		_reusedIndexList.Sort();
 		for (int32 i = _reusedIndexList.Num() - 1; i >= 0; i--)
 		{
 			index = _reusedIndexList[i];
-			if (!_tweenInstances.IsValidIndex(index))
+			if (!_tweenTimings.IsValidIndex(index) || (i + 1 < _reusedIndexList.Num() && _reusedIndexList[i + 1] == index))
 				continue;
-			const FGuid guid = _tweenInstances[index].Identifier;
-			if (_tweenInstanceIndexesMap.Contains(guid))
-				_tweenInstanceIndexesMap.Remove(guid);
-			if (!_unUsedGUIDs.Contains(guid))
-				_unUsedGUIDs.Add(guid);
-			if (_tweenInstances[index].IsComplete())
+			const FGuid guid = _tweenColdData[index].Identifier;
+			if (_tweenTimings[index].IsComplete())
 			{
-				_sequenceChkSet.Add(guid);
+				_tweenSubscribers.Remove(guid);
 			}
 			else
 			{
-				_cancelledSet.Add(guid);
-				_sequenceChkSet.Add(guid);
+				if (_bGlobalEventsBound)
+					_cancelledSet.Add(guid);
+				QueueTweenEvent_Internal(guid, EPulseTweenEvent::Cancelled, true);
+			}
+			UE_LOG(LogPulseTweening, Log, TEXT("Tween %s %s"), *guid.ToString(), *FString(_tweenTimings[index].IsComplete()? "Completed" : "Deleted"));
+			// Sequence steps are replaced in place by the next step. Their IDs are kept for the next loops.
+			if (_tweenColdData[index].SequenceID.IsValid())
+			{
+				if (AdvanceSequence_Internal(index))
+					continue;
 			}
-			UE_LOG(LogPulseTweening, Log, TEXT("Tween %s %s"), *_tweenInstances[index].Identifier.ToString(),
-			       *FString(_tweenInstances[index].IsComplete()? "Completed" : "Deleted"));
-			_tweenInstances.RemoveAt(index);
-		}
-		// Update index map
-		for (int i = 0; i < _tweenInstances.Num(); i++)
-		{
-			if (_tweenInstanceIndexesMap.Contains(_tweenInstances[i].Identifier))
-				_tweenInstanceIndexesMap[_tweenInstances[i].Identifier] = i;
 			else
-				_tweenInstanceIndexesMap.Add(_tweenInstances[i].Identifier, i);
+			{
+				// Removed indexes are unique, and a recycled ID leaves the list when reused: no duplicate to check for.
+				_unUsedGUIDs.Add(guid);
+			}
+			_tweenHandles.Remove(guid);
+			RemoveTweenAt_Internal(index);
 		}
 	}
+	// Write to targets
+	ApplyTargets_Internal();
 	// Broadcast Events
 	if (MustTriggerEvents())
 	{
@@ -250,60 +373,48 @@ void UPulseTween::Tick(float DeltaTime)
 			OnTweenPingPongApexEvent.Broadcast(_pingPongApexSet);
 		if (_loopSet.Num() > 0)
 			OnTweenLoopEvent.Broadcast(_loopSet);
-		if (_sequenceChkSet.Num() > 0)
-		{
-			// Start next instance in sequence
-			for (int i = _ActiveSequences.Num() - 1; i >= 0; i--)
-			{
-				int32 pastIndex = _ActiveSequences[i].CurrentIndex;
-				if (_ActiveSequences[i].SequenceNext(_sequenceChkSet))
-				{
-					FPulseTweenInstance Instance;
-					if (_ActiveSequences[i].GetCurrentInstance(Instance))
-					{
-						UE_LOG(LogPulseTweening, Log, TEXT("Sequence %s Moved Next to Index %d from %d"), *_ActiveSequences[i].TweenSequenceID.ToString(),
-						       _ActiveSequences[i].CurrentIndex, pastIndex);
-						_sequenceMoveNextSet.Add(_ActiveSequences[i].TweenSequenceID);
-						if (_tweenInstanceIndexesMap.Contains(Instance.Identifier))
-						{
-							if (!_tweenInstances.IsValidIndex(_tweenInstanceIndexesMap[Instance.Identifier]))
-								continue;
-							_tweenInstances[_tweenInstanceIndexesMap[Instance.Identifier]].Reset();
-						}
-						else
-						{
-							_newTweensQueue.Enqueue(Instance);
-						}
-					}
-				}
-				else
-				{
-					_sequenceCompletedSet.Add(_ActiveSequences[i].TweenSequenceID);
-					_ActiveSequences.RemoveAt(i);
-				}
-			}
-		}
 		if (_sequenceCompletedSet.Num() > 0)
 			OnTweenSequenceCompletedEvent.Broadcast(_sequenceCompletedSet);
 		if (_sequenceMoveNextSet.Num() > 0)
 			OnTweenSequenceMoveNextEvent.Broadcast(_sequenceMoveNextSet);
 	}
+	// Per tween subscribers
+	DispatchTweenEvents_Internal();
 }
 
 bool UPulseTween::GetTweenInstance(const FGuid& Guid, FPulseTweenInstance& OutInstance)
 {
-	if (!_tweenInstanceIndexesMap.Contains(Guid))
+	const int32 index = FindTweenIndex_Internal(Guid);
+	if (index == INDEX_NONE)
 		return false;
-	const int32 index = _tweenInstanceIndexesMap[Guid];
-	if (!_tweenInstances.IsValidIndex(index))
+	OutInstance = FPulseTweenInstance(_tweenTimings[index], _tweenColdData[index]);
+	return true;
+}
+
+FPulseTweenHandle UPulseTween::GetTweenHandle(const FGuid& Guid) const
+{
+	const FPulseTweenHandle* handle = _tweenHandles.Find(Guid);
+	return handle ? *handle : FPulseTweenHandle();
+}
+
+const FPulseTweenTiming* UPulseTween::FindTweenTiming(const FPulseTweenHandle& Handle) const
+{
+	const int32 index = _tweenSlots.Find(Handle);
+	return _tweenTimings.IsValidIndex(index) ? &_tweenTimings[index] : nullptr;
+}
+
+bool UPulseTween::GetTweenValue(const FPulseTweenHandle& Handle, float& OutTweenValue) const
+{
+	const int32 index = _tweenSlots.Find(Handle);
+	if (!_tweenValues.IsValidIndex(index))
 		return false;
-	OutInstance = _tweenInstances[index];
+	OutTweenValue = _tweenValues[index];
 	return true;
 }
 
 bool UPulseTween::PauseTweenInstance(const FGuid& Guid)
 {
-	if (!_tweenInstanceIndexesMap.Contains(Guid))
+	if (!_tweenHandles.Contains(Guid))
 		return false;
 	if (_tweenStatusChangeRequest.Contains(Guid))
 	{
@@ -320,7 +431,7 @@ bool UPulseTween::PauseTweenInstance(const FGuid& Guid)
 
 bool UPulseTween::ResumeTweenInstance(const FGuid& Guid)
 {
-	if (!_tweenInstanceIndexesMap.Contains(Guid))
+	if (!_tweenHandles.Contains(Guid))
 		return false;
 	if (_tweenStatusChangeRequest.Contains(Guid))
 	{
@@ -337,7 +448,7 @@ bool UPulseTween::ResumeTweenInstance(const FGuid& Guid)
 
 bool UPulseTween::ResetTweenInstance(const FGuid& Guid)
 {
-	if (!_tweenInstanceIndexesMap.Contains(Guid))
+	if (!_tweenHandles.Contains(Guid))
 		return false;
 	if (_tweenStatusChangeRequest.Contains(Guid))
 	{
@@ -354,38 +465,21 @@ bool UPulseTween::ResetTweenInstance(const FGuid& Guid)
 
 bool UPulseTween::ResetSequence(const FGuid& Guid)
 {
-	const int32 indexOf = _ActiveSequences.IndexOfByPredicate([Guid](const FPulseTweenSequence& sequence)-> bool
-	{
-		return sequence.TweenSequenceID == Guid;
-	});
-	if (indexOf == INDEX_NONE)
+	FPulseTweenSequence* sequence = FindSequence_Internal(Guid);
+	if (!sequence || sequence->wasCancelled)
 		return false;
-	FPulseTweenInstance Instance = {};
-	if (_ActiveSequences[indexOf].GetCurrentInstance(Instance))
-		CancelTweenInstance(Instance.Identifier);
-	Instance = {};
-	_ActiveSequences[indexOf].CurrentIndex = 0;
-	if (_ActiveSequences[indexOf].GetCurrentInstance(Instance))
-	{
-		if (_tweenInstanceIndexesMap.Contains(Instance.Identifier))
-		{
-			if (!_tweenInstances.IsValidIndex(_tweenInstanceIndexesMap[Instance.Identifier]))
-				return false;
-			ResetTweenInstance(Instance.Identifier);
-			_ActiveSequences[indexOf].wasRestarted = true;
-		}
-		else
-		{
-			_newTweensQueue.Enqueue(Instance);
-		}
-		return true;
-	}
-	return false;
+	// The current step tween is cancelled, and replaced by the first step when removed.
+	const int32 step = sequence->GetCurrentStep();
+	if (step != INDEX_NONE && CancelTweenInstance(_sequenceStepColdData[step].Identifier))
+		sequence->wasRestarted = true;
+	else
+		sequence->CurrentIndex = 0;
+	return true;
 }
 
 bool UPulseTween::CancelTweenInstance(const FGuid& Guid)
 {
-	if (!_tweenInstanceIndexesMap.Contains(Guid))
+	if (!_tweenHandles.Contains(Guid))
 		return false;
 	if (_tweenStatusChangeRequest.Contains(Guid))
 	{
@@ -400,81 +494,626 @@ bool UPulseTween::CancelTweenInstance(const FGuid& Guid)
 
 bool UPulseTween::CancelSequence(const FGuid& Guid)
 {
-	const int32 indexOf = _ActiveSequences.IndexOfByPredicate([Guid](const FPulseTweenSequence& sequence)-> bool
-	{
-		return sequence.TweenSequenceID == Guid;
-	});
-	if (indexOf == INDEX_NONE)
+	FPulseTweenSequence* sequence = FindSequence_Internal(Guid);
+	if (!sequence)
 		return false;
-	FPulseTweenInstance Instance = {};
-	if (_ActiveSequences[indexOf].GetCurrentInstance(Instance))
-		CancelTweenInstance(Instance.Identifier);
-	_ActiveSequences[indexOf].CurrentIndex = -1;
+	// The sequence ends with its current step tween. A step tween not started yet is cancelled when added.
+	sequence->wasCancelled = true;
+	sequence->wasRestarted = false;
+	const int32 step = sequence->GetCurrentStep();
+	if (step != INDEX_NONE)
+		CancelTweenInstance(_sequenceStepColdData[step].Identifier);
 	return true;
 }
 
+FDelegateHandle UPulseTween::SubscribeToTween(const FGuid& TweenOrSequenceID, FPulseTweenNativeEvent::FDelegate&& Callback)
+{
+	if (!TweenOrSequenceID.IsValid() || !Callback.IsBound())
+		return {};
+	TSharedPtr<FPulseTweenNativeEvent>& subscribers = _tweenSubscribers.FindOrAdd(TweenOrSequenceID);
+	if (!subscribers.IsValid())
+		subscribers = MakeShared<FPulseTweenNativeEvent>();
+	return subscribers->Add(MoveTemp(Callback));
+}
+
+bool UPulseTween::UnsubscribeFromTween(const FGuid& TweenOrSequenceID, FDelegateHandle Handle)
+{
+	TSharedPtr<FPulseTweenNativeEvent>* subscribers = _tweenSubscribers.Find(TweenOrSequenceID);
+	if (!subscribers || !(*subscribers)->Remove(Handle))
+		return false;
+	if (!(*subscribers)->IsBound())
+		_tweenSubscribers.Remove(TweenOrSequenceID);
+	return true;
+}
+
+bool UPulseTween::UnsubscribeFromTween(const FGuid& TweenOrSequenceID, const void* UserObject)
+{
+	TSharedPtr<FPulseTweenNativeEvent>* subscribers = _tweenSubscribers.Find(TweenOrSequenceID);
+	if (!subscribers || (*subscribers)->RemoveAll(UserObject) <= 0)
+		return false;
+	if (!(*subscribers)->IsBound())
+		_tweenSubscribers.Remove(TweenOrSequenceID);
+	return true;
+}
+
+void UPulseTween::PauseTweenGroup(FName Group)
+{
+	_tweenGroups[FindOrAddTweenGroup_Internal(Group)].bPaused = true;
+}
+
+void UPulseTween::ResumeTweenGroup(FName Group)
+{
+	_tweenGroups[FindOrAddTweenGroup_Internal(Group)].bPaused = false;
+}
+
+void UPulseTween::CancelTweenGroup(FName Group)
+{
+	if (const int32* index = _tweenGroupIndexes.Find(Group))
+	{
+		UE_LOG(LogPulseTweening, Log, TEXT("Tween group %s Cancelled"), *Group.ToString());
+		_tweenGroups[*index].CancelCount++;
+	}
+}
+
+void UPulseTween::SetTweenGroupTimeScale(FName Group, float TimeScale)
+{
+	_tweenGroups[FindOrAddTweenGroup_Internal(Group)].TimeScale = FMath::Max(TimeScale, 0.0f);
+}
+
+bool UPulseTween::IsTweenGroupPaused(FName Group) const
+{
+	const FPulseTweenGroupState* group = FindTweenGroup_Internal(Group);
+	return group && group->bPaused;
+}
+
+float UPulseTween::GetTweenGroupTimeScale(FName Group) const
+{
+	const FPulseTweenGroupState* group = FindTweenGroup_Internal(Group);
+	return group ? group->TimeScale : 1;
+}
+
+void UPulseTween::SetMultiThreadThreshold(int32 TweenCount)
+{
+	_tweenCountMT = TweenCount;
+}
+
+void UPulseTween::SetEaseLookupTables(bool bEnable, int32 SampleCount)
+{
+	_easeTables.Reset();
+	if (!bEnable)
+		return;
+	_easeLUTSamples = FMath::Clamp(SampleCount, FPulseEaseLUT::MinSamples, FPulseEaseLUT::MaxSamples);
+	constexpr int32 easeCount = static_cast<int32>(EPulseTweenEase::InOutBack) + 1;
+	_easeTables.SetNum(easeCount);
+	for (int32 e = 0; e < easeCount; e++)
+	{
+		const EPulseTweenEase ease = static_cast<EPulseTweenEase>(e);
+		if (FPulseEaseLUT::IsWorthTable(ease))
+			_easeTables[e] = FPulseEaseLUT::GetShared(_easeEvaluator, ease, _easeLUTSamples);
+	}
+}
+
 bool UPulseTween::DoesSupportWorldType(const EWorldType::Type WorldType) const
 {
 	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
 }
 
-bool UPulseTween::AddToStatusSet(const FPulseTweenInstance& tweenInstance, FRWLock& Lock)
+bool UPulseTween::AddToStatusSet(int32 TweenIndex)
 {
-	switch (tweenInstance.Status)
+	const FGuid& guid = _tweenColdData[TweenIndex].Identifier;
+	const EPulseTweenStatus status = _tweenTimings[TweenIndex].Status;
+	EPulseTweenEvent event = EPulseTweenEvent::Update;
+	if (!_tweenSubscribers.IsEmpty() && GetStatusEvent(status, event))
+		QueueTweenEvent_Internal(guid, event);
+	if (status == EPulseTweenStatus::JustStarted)
+		UE_LOG(LogPulseTweening, Log, TEXT("Tween %s Started"), *guid.ToString());
+	if (!_bGlobalEventsBound)
+		return HasStatusEvent(status);
+	switch (status)
 	{
 	default: break;
 	case EPulseTweenStatus::Updating:
+		_updatingSet.Add(guid);
+		return true;
+	case EPulseTweenStatus::JustStarted:
+		_startedSet.Add(guid);
+		return true;
+	case EPulseTweenStatus::JustPaused:
+		_pausedSet.Add(guid);
+		return true;
+	case EPulseTweenStatus::JustResumed:
+		_resumedSet.Add(guid);
+		return true;
+	case EPulseTweenStatus::JustReachedPingPongApex:
+		_pingPongApexSet.Add(guid);
+		return true;
+	case EPulseTweenStatus::JustLooped:
+		_loopSet.Add(guid);
+		return true;
+	case EPulseTweenStatus::JustCompleted:
+		_completedSet.Add(guid);
+		return true;
+	}
+	return false;
+}
+
+bool UPulseTween::HasStatusEvent(EPulseTweenStatus Status)
+{
+	switch (Status)
+	{
+	case EPulseTweenStatus::Updating:
+	case EPulseTweenStatus::JustStarted:
+	case EPulseTweenStatus::JustPaused:
+	case EPulseTweenStatus::JustResumed:
+	case EPulseTweenStatus::JustReachedPingPongApex:
+	case EPulseTweenStatus::JustLooped:
+	case EPulseTweenStatus::JustCompleted:
+		return true;
+	default:
+		return false;
+	}
+}
+
+int32 UPulseTween::FindTweenIndex_Internal(const FGuid& Guid) const
+{
+	const FPulseTweenHandle* handle = _tweenHandles.Find(Guid);
+	return handle ? _tweenSlots.Find(*handle) : INDEX_NONE;
+}
+
+void UPulseTween::UpdateTweenRange_Internal(int32 Start, int32 End, float DeltaTime, float TimeDilation, bool bIsPaused, FPulseTweenTickBuffer& Buffer)
+{
+	for (int32 i = Start; i < End; i++)
+	{
+		FPulseTweenTiming& timing = _tweenTimings[i];
+		// Remove completed
+		if (timing.IsComplete())
 		{
-			FWriteScopeLock W(Lock);
-			_updatingSet.Add(tweenInstance.Identifier);
-			return true;
+			Buffer.Removed.Add(i);
+			continue;
 		}
-		break;
-	case EPulseTweenStatus::JustStarted:
+		const FPulseTweenGroupState& group = _tweenGroups[timing.Group];
+		// Cancelled with its group
+		if (timing.GroupCancelCount != group.CancelCount)
 		{
-			FWriteScopeLock W(Lock);
-			_startedSet.Add(tweenInstance.Identifier);
-			UE_LOG(LogPulseTweening, Log, TEXT("Tween %s Started"), *tweenInstance.Identifier.ToString());
-			return true;
+			Buffer.Removed.Add(i);
+			continue;
 		}
-		break;
-	case EPulseTweenStatus::JustPaused:
+		timing.Update(DeltaTime * group.TimeScale, TimeDilation, bIsPaused, group.bPaused);
+		if (HasStatusEvent(timing.Status))
+			Buffer.Events.Add(i);
+	}
+	EvaluateEases_Internal(Start, End, Buffer);
+}
+
+void UPulseTween::EvaluateEases_Internal(int32 Start, int32 End, FPulseTweenTickBuffer& Buffer)
+{
+	constexpr int32 easeCount = static_cast<int32>(EPulseTweenEase::InOutBack) + 1;
+	// Tweens easing with a curve are grouped in an extra run after the eases.
+	constexpr int32 runTypeCount = easeCount + 1;
+	const int32 count = End - Start;
+	if (count <= 0)
+		return;
+	auto getRunType = [](const FPulseTweenTiming& Timing)
+	{
+		return Timing.CurveTable != INDEX_NONE ? easeCount : static_cast<int32>(Timing.GetCurrentEase());
+	};
+	// Counting sort of the range by ease, so each ease is evaluated over a contiguous run.
+	int32 easeOffsets[runTypeCount + 1] = {};
+	for (int32 i = Start; i < End; i++)
+		easeOffsets[getRunType(_tweenTimings[i]) + 1]++;
+	for (int32 e = 1; e <= runTypeCount; e++)
+		easeOffsets[e] += easeOffsets[e - 1];
+	Buffer.EaseOrder.SetNumUninitialized(count, EAllowShrinking::No);
+	Buffer.EaseInputs.SetNumUninitialized(count, EAllowShrinking::No);
+	Buffer.EaseOutputs.SetNumUninitialized(count, EAllowShrinking::No);
+	int32 easeCursors[runTypeCount];
+	FMemory::Memcpy(easeCursors, easeOffsets, sizeof(easeCursors));
+	for (int32 i = Start; i < End; i++)
+	{
+		const FPulseTweenTiming& timing = _tweenTimings[i];
+		const int32 slot = easeCursors[getRunType(timing)]++;
+		Buffer.EaseOrder[slot] = i;
+		Buffer.EaseInputs[slot] = timing.GetProgress();
+	}
+	for (int32 e = 0; e < easeCount; e++)
+	{
+		const int32 runCount = easeOffsets[e + 1] - easeOffsets[e];
+		if (runCount <= 0)
+			continue;
+		const float* inputs = Buffer.EaseInputs.GetData() + easeOffsets[e];
+		float* outputs = Buffer.EaseOutputs.GetData() + easeOffsets[e];
+		if (_easeTables.IsValidIndex(e) && _easeTables[e].IsValid())
+			_easeTables[e]->EvaluateBatch(inputs, outputs, runCount);
+		else
+			_easeEvaluator.EvaluateBatch(static_cast<EPulseTweenEase>(e), inputs, outputs, runCount);
+	}
+	for (int32 k = easeOffsets[easeCount]; k < count; k++)
+		Buffer.EaseOutputs[k] = _curveTables[_tweenTimings[Buffer.EaseOrder[k]].CurveTable].Evaluate(Buffer.EaseInputs[k]);
+	for (int32 k = 0; k < count; k++)
+		_tweenValues[Buffer.EaseOrder[k]] = Buffer.EaseOutputs[k];
+}
+
+void UPulseTween::AddTween_Internal(const FPulseTweenInstance& TweenInstance)
+{
+	_tweenHandles.Add(TweenInstance.Identifier, _tweenSlots.Add());
+	_tweenTimings.Add(TweenInstance);
+	const FPulseTweenColdData& coldData = _tweenColdData.Add_GetRef(TweenInstance.GetColdData());
+	if (const UCurveFloat* curve = coldData.EaseCurve.Get())
+		_tweenTimings.Last().CurveTable = GetCurveTable_Internal(curve);
+	_tweenValues.Add(EvaluateTween_Internal(_tweenTimings.Num() - 1));
+	if (_tweenTimings.Last().AttachedToOwner)
+		RegisterTweenOwner_Internal(_tweenTimings.Num() - 1);
+	if (coldData.SequenceID.IsValid())
+	{
+		// The sequence was cancelled while its first step was queued.
+		const FPulseTweenSequence* sequence = FindSequence_Internal(coldData.SequenceID);
+		if (!sequence || sequence->wasCancelled)
+			_reusedIndexList.Add(_tweenTimings.Num() - 1);
+	}
+}
+
+FPulseTweenSequence* UPulseTween::FindSequence_Internal(const FGuid& SequenceID)
+{
+	const int32* index = _sequenceIndexes.Find(SequenceID);
+	return index ? &_ActiveSequences[*index] : nullptr;
+}
+
+const FPulseTweenSequence* UPulseTween::FindSequence_Internal(const FGuid& SequenceID) const
+{
+	const int32* index = _sequenceIndexes.Find(SequenceID);
+	return index ? &_ActiveSequences[*index] : nullptr;
+}
+
+bool UPulseTween::AdvanceSequence_Internal(int32 TweenIndex)
+{
+	FPulseTweenColdData& coldData = _tweenColdData[TweenIndex];
+	const int32* sequenceIndex = _sequenceIndexes.Find(coldData.SequenceID);
+	if (!sequenceIndex)
+		return false;
+	const int32 index = *sequenceIndex;
+	FPulseTweenSequence& sequence = _ActiveSequences[index];
+	FPulseTweenTiming& timing = _tweenTimings[TweenIndex];
+	const int32 pastIndex = sequence.CurrentIndex;
+	// A sequence also ends with its owner and with a cancel of its group.
+	const bool bAborted = (timing.AttachedToOwner && coldData.Owner.IsStale(true, true)) || timing.GroupCancelCount != _tweenGroups[timing.Group].CancelCount;
+	if (bAborted || !sequence.MoveNext())
+	{
+		UE_LOG(LogPulseTweening, Log, TEXT("Sequence %s Completed"), *sequence.TweenSequenceID.ToString());
+		_sequenceCompletedSet.Add(sequence.TweenSequenceID);
+		QueueTweenEvent_Internal(sequence.TweenSequenceID, EPulseTweenEvent::SequenceCompleted, true);
+		RemoveSequenceAt_Internal(index);
+		return false;
+	}
+	UE_LOG(LogPulseTweening, Log, TEXT("Sequence %s Moved Next to Index %d from %d"), *sequence.TweenSequenceID.ToString(), sequence.CurrentIndex, pastIndex);
+	_sequenceMoveNextSet.Add(sequence.TweenSequenceID);
+	QueueTweenEvent_Internal(sequence.TweenSequenceID, EPulseTweenEvent::SequenceMoveNext);
+	// The next step takes the slot of the ended one, under a new handle so the old one goes stale.
+	const int32 step = sequence.GetCurrentStep();
+	const FPulseTweenColdData& stepColdData = _sequenceStepColdData[step];
+	const FPulseTweenHandle oldHandle = _tweenSlots.GetHandle(TweenIndex);
+	const FPulseTweenHandle newHandle = _tweenSlots.Reissue(TweenIndex);
+	_tweenHandles.Remove(coldData.Identifier);
+	_tweenHandles.Add(stepColdData.Identifier, newHandle);
+	if (timing.AttachedToOwner)
+	{
+		if (const int32* entryIndex = _tweenOwnerIndexes.Find(coldData.OwnerKey))
 		{
-			FWriteScopeLock W(Lock);
-			_pausedSet.Add(tweenInstance.Identifier);
-			return true;
+			const int32 handleIndex = _tweenOwners[*entryIndex].Tweens.Find(oldHandle);
+			if (handleIndex != INDEX_NONE)
+				_tweenOwners[*entryIndex].Tweens[handleIndex] = newHandle;
 		}
-		break;
-	case EPulseTweenStatus::JustResumed:
+	}
+	timing = _sequenceStepTimings[step];
+	timing.GroupCancelCount = _tweenGroups[timing.Group].CancelCount;
+	// Steps share the owner, only the step data is replaced.
+	coldData.Identifier = stepColdData.Identifier;
+	coldData.EaseCurve = stepColdData.EaseCurve;
+	coldData.Group = stepColdData.Group;
+	_tweenValues[TweenIndex] = EvaluateTween_Internal(TweenIndex);
+	return true;
+}
+
+void UPulseTween::RemoveSequenceAt_Internal(int32 SequenceIndex)
+{
+	const FPulseTweenSequence sequence = _ActiveSequences[SequenceIndex];
+	for (int32 step = sequence.FirstStep; step < sequence.FirstStep + sequence.StepCount; step++)
+		_stepSequenceIDs.Remove(_sequenceStepColdData[step].Identifier);
+	_sequenceStepTimings.RemoveAt(sequence.FirstStep, sequence.StepCount, EAllowShrinking::No);
+	_sequenceStepColdData.RemoveAt(sequence.FirstStep, sequence.StepCount, EAllowShrinking::No);
+	for (FPulseTweenSequence& other : _ActiveSequences)
+	{
+		if (other.FirstStep > sequence.FirstStep)
+			other.FirstStep -= sequence.StepCount;
+	}
+	_sequenceIndexes.Remove(sequence.TweenSequenceID);
+	_ActiveSequences.RemoveAtSwap(SequenceIndex, 1, EAllowShrinking::No);
+	// The last sequence now sits in the freed index, update its index.
+	if (_ActiveSequences.IsValidIndex(SequenceIndex))
+		_sequenceIndexes.Add(_ActiveSequences[SequenceIndex].TweenSequenceID, SequenceIndex);
+}
+
+void UPulseTween::RegisterTweenOwner_Internal(int32 TweenIndex)
+{
+	FPulseTweenColdData& coldData = _tweenColdData[TweenIndex];
+	const UObject* owner = coldData.Owner.Get();
+	if (!owner)
+	{
+		// The owner ended while the tween was queued.
+		_reusedIndexList.Add(TweenIndex);
+		return;
+	}
+	coldData.OwnerKey = FObjectKey(owner);
+	int32 entryIndex = INDEX_NONE;
+	if (const int32* index = _tweenOwnerIndexes.Find(coldData.OwnerKey))
+	{
+		entryIndex = *index;
+	}
+	else
+	{
+		FPulseTweenOwnerEntry entry;
+		entry.Key = coldData.OwnerKey;
+		entry.Owner = owner;
+		entryIndex = _tweenOwners.Add(entry);
+		_tweenOwnerIndexes.Add(entry.Key, entryIndex);
+		if (AActor* actor = Cast<AActor>(const_cast<UObject*>(owner)))
 		{
-			FWriteScopeLock W(Lock);
-			_resumedSet.Add(tweenInstance.Identifier);
-			return true;
+			actor->OnDestroyed.AddUniqueDynamic(this, &UPulseTween::OnTweenOwnerDestroyed_Internal);
+			actor->OnEndPlay.AddUniqueDynamic(this, &UPulseTween::OnTweenOwnerEndPlay_Internal);
 		}
-		break;
-	case EPulseTweenStatus::JustReachedPingPongApex:
+	}
+	_tweenOwners[entryIndex].Tweens.Add(_tweenSlots.GetHandle(TweenIndex));
+}
+
+void UPulseTween::UnregisterTweenOwner_Internal(int32 TweenIndex)
+{
+	const int32* entryIndex = _tweenOwnerIndexes.Find(_tweenColdData[TweenIndex].OwnerKey);
+	if (!entryIndex)
+		return;
+	const int32 index = *entryIndex;
+	_tweenOwners[index].Tweens.RemoveSingleSwap(_tweenSlots.GetHandle(TweenIndex), EAllowShrinking::No);
+	if (_tweenOwners[index].Tweens.IsEmpty())
+		RemoveTweenOwnerAt_Internal(index);
+}
+
+void UPulseTween::RemoveTweenOwnerAt_Internal(int32 EntryIndex)
+{
+	const FPulseTweenOwnerEntry& entry = _tweenOwners[EntryIndex];
+	if (AActor* actor = Cast<AActor>(const_cast<UObject*>(entry.Owner.Get())))
+	{
+		actor->OnDestroyed.RemoveDynamic(this, &UPulseTween::OnTweenOwnerDestroyed_Internal);
+		actor->OnEndPlay.RemoveDynamic(this, &UPulseTween::OnTweenOwnerEndPlay_Internal);
+	}
+	_tweenOwnerIndexes.Remove(entry.Key);
+	_tweenOwners.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	// The last entry now sits in the freed slot, update its index.
+	if (_tweenOwners.IsValidIndex(EntryIndex))
+		_tweenOwnerIndexes.Add(_tweenOwners[EntryIndex].Key, EntryIndex);
+}
+
+void UPulseTween::CancelEndedOwnersTweens_Internal()
+{
+	auto cancelOwnerTweens = [this](const FPulseTweenOwnerEntry& Entry)
+	{
+		for (const FPulseTweenHandle& handle : Entry.Tweens)
 		{
-			FWriteScopeLock W(Lock);
-			_pingPongApexSet.Add(tweenInstance.Identifier);
-			return true;
+			const int32 index = _tweenSlots.Find(handle);
+			if (index != INDEX_NONE)
+				_reusedIndexList.Add(index);
 		}
-		break;
-	case EPulseTweenStatus::JustLooped:
+	};
+	for (const FObjectKey& ownerKey : _endedOwners)
+	{
+		if (const int32* entryIndex = _tweenOwnerIndexes.Find(ownerKey))
 		{
-			FWriteScopeLock W(Lock);
-			_loopSet.Add(tweenInstance.Identifier);
-			return true;
+			UE_LOG(LogPulseTweening, Log, TEXT("Tween owner ended, cancelling its %d tweens"), _tweenOwners[*entryIndex].Tweens.Num());
+			cancelOwnerTweens(_tweenOwners[*entryIndex]);
 		}
+	}
+	_endedOwners.Reset();
+	// Owners without an end event are checked a few at a time. Entries are only removed with their tweens, after this.
+	const int32 sweepCount = FMath::Min(OwnerSweepBudget, _tweenOwners.Num());
+	for (int32 i = 0; i < sweepCount; i++)
+	{
+		if (_ownerSweepCursor >= _tweenOwners.Num())
+			_ownerSweepCursor = 0;
+		const FPulseTweenOwnerEntry& entry = _tweenOwners[_ownerSweepCursor++];
+		if (entry.Owner.IsStale(true, true))
+			cancelOwnerTweens(entry);
+	}
+}
+
+void UPulseTween::OnTweenOwnerDestroyed_Internal(AActor* DestroyedActor)
+{
+	if (DestroyedActor)
+		_endedOwners.Add(FObjectKey(DestroyedActor));
+}
+
+void UPulseTween::OnTweenOwnerEndPlay_Internal(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	if (Actor)
+		_endedOwners.Add(FObjectKey(Actor));
+}
+
+void UPulseTween::EnqueueTween_Internal(FPulseTweenInstance TweenInstance)
+{
+	TweenInstance.Group = FindOrAddTweenGroup_Internal(TweenInstance.GetGroupName());
+	TweenInstance.GroupCancelCount = _tweenGroups[TweenInstance.Group].CancelCount;
+	_newTweensQueue.Enqueue(TweenInstance);
+}
+
+int32 UPulseTween::FindOrAddTweenGroup_Internal(FName Group)
+{
+	if (const int32* index = _tweenGroupIndexes.Find(Group))
+		return *index;
+	FPulseTweenGroupState state;
+	state.Name = Group;
+	const int32 index = _tweenGroups.Add(state);
+	_tweenGroupIndexes.Add(Group, index);
+	return index;
+}
+
+const FPulseTweenGroupState* UPulseTween::FindTweenGroup_Internal(FName Group) const
+{
+	const int32* index = _tweenGroupIndexes.Find(Group);
+	return index ? &_tweenGroups[*index] : nullptr;
+}
+
+float UPulseTween::EvaluateTween_Internal(int32 Index) const
+{
+	const FPulseTweenTiming& timing = _tweenTimings[Index];
+	if (timing.CurveTable != INDEX_NONE)
+		return _curveTables[timing.CurveTable].Evaluate(timing.GetProgress());
+	const int32 ease = static_cast<int32>(timing.GetCurrentEase());
+	if (_easeTables.IsValidIndex(ease) && _easeTables[ease].IsValid())
+		return _easeTables[ease]->Evaluate(timing.GetProgress());
+	return _easeEvaluator.Evaluate(timing.GetCurrentEase(), timing.GetProgress());
+}
+
+int32 UPulseTween::GetCurveTable_Internal(const UCurveFloat* Curve)
+{
+	const FObjectKey key(Curve);
+	if (const int32* index = _curveTableIndexes.Find(key))
+		return *index;
+	const int32 index = _curveTables.Add(FPulseEaseLUT::Bake(Curve, _easeLUTSamples));
+	_curveTableIndexes.Add(key, index);
+	return index;
+}
+
+bool UPulseTween::BindTarget_Internal(const FGuid& TweenID, const FPulseTweenTarget& Target)
+{
+	const FPulseTweenHandle* handle = _tweenHandles.Find(TweenID);
+	UObject* object = Target.Object.Get();
+	if (!handle || !object || Target.Type == EPulseTweenTargetType::None || Target.Type == EPulseTweenTargetType::Count)
+		return false;
+	FPulseTweenTargetBinding binding;
+	binding.Tween = *handle;
+	binding.Target = Target;
+	bool isValid = false;
+	switch (Target.Type)
+	{
+	default:
 		break;
-	case EPulseTweenStatus::JustCompleted:
+	case EPulseTweenTargetType::ActorTransform:
+		isValid = object->IsA<AActor>();
+		break;
+	case EPulseTweenTargetType::ComponentTransform:
+	case EPulseTweenTargetType::RelativeLocation:
+		isValid = object->IsA<USceneComponent>();
+		break;
+	case EPulseTweenTargetType::MaterialScalar:
+		if (auto material = Cast<UMaterialInstanceDynamic>(object))
+			isValid = material->InitializeScalarParameterAndGetIndex(FName(*Target.Path), Target.FromValue.X, binding.ParameterIndex);
+		break;
+	case EPulseTweenTargetType::MaterialVector:
+		if (auto material = Cast<UMaterialInstanceDynamic>(object))
+			isValid = material->InitializeVectorParameterAndGetIndex(FName(*Target.Path), FLinearColor(Target.FromValue), binding.ParameterIndex);
+		break;
+	case EPulseTweenTargetType::WidgetOpacity:
+	case EPulseTweenTargetType::WidgetTransform:
+		isValid = object->IsA<UWidget>();
+		break;
+	case EPulseTweenTargetType::Property:
+		isValid = PulseTweenTargets::ResolvePropertyChain(object, Target.Path, binding.PropertyChain);
+		break;
+	}
+	if (!isValid)
+	{
+		UE_LOG(LogPulseTweening, Warning, TEXT("Tween %s: target %s can't be bound to %s"), *TweenID.ToString(), *UEnum::GetValueAsString(Target.Type), *object->GetName());
+		return false;
+	}
+	_targetBatches[static_cast<int32>(Target.Type)].Bindings.Add(MoveTemp(binding));
+	return true;
+}
+
+void UPulseTween::ApplyTargets_Internal()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Tick::ApplyTargets);
+	for (FPulseTweenTargetBatch& batch : _targetBatches)
+	{
+		for (int32 i = batch.Bindings.Num() - 1; i >= 0; i--)
 		{
-			FWriteScopeLock W(Lock);
-			_completedSet.Add(tweenInstance.Identifier);
-			return true;
+			FPulseTweenTargetBinding& binding = batch.Bindings[i];
+			const int32 index = _tweenSlots.Find(binding.Tween);
+			UObject* object = binding.Target.Object.Get();
+			if (index == INDEX_NONE || !object)
+			{
+				// A tween whose target is gone has nothing left to animate.
+				if (index != INDEX_NONE)
+					CancelTweenInstance(_tweenColdData[index].Identifier);
+				batch.Bindings.RemoveAtSwap(i, 1, EAllowShrinking::No);
+				continue;
+			}
+			const float value = _tweenValues[index];
+			if (value == binding.LastValue)
+				continue;
+			binding.LastValue = value;
+			PulseTweenTargets::Apply(binding, object, value);
 		}
-		break;
 	}
-	return false;
+}
+
+void UPulseTween::RemoveTweenAt_Internal(int32 Index)
+{
+	if (_tweenTimings[Index].AttachedToOwner)
+		UnregisterTweenOwner_Internal(Index);
+	_tweenSlots.RemoveAtSwap(Index);
+	_tweenTimings.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	_tweenColdData.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	_tweenValues.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+bool UPulseTween::GetStatusEvent(EPulseTweenStatus Status, EPulseTweenEvent& OutEvent)
+{
+	switch (Status)
+	{
+	case EPulseTweenStatus::Updating:
+		OutEvent = EPulseTweenEvent::Update;
+		return true;
+	case EPulseTweenStatus::JustStarted:
+		OutEvent = EPulseTweenEvent::Started;
+		return true;
+	case EPulseTweenStatus::JustPaused:
+		OutEvent = EPulseTweenEvent::Paused;
+		return true;
+	case EPulseTweenStatus::JustResumed:
+		OutEvent = EPulseTweenEvent::Resumed;
+		return true;
+	case EPulseTweenStatus::JustReachedPingPongApex:
+		OutEvent = EPulseTweenEvent::PingPongApex;
+		return true;
+	case EPulseTweenStatus::JustLooped:
+		OutEvent = EPulseTweenEvent::Looped;
+		return true;
+	case EPulseTweenStatus::JustCompleted:
+		OutEvent = EPulseTweenEvent::Completed;
+		return true;
+	default:
+		return false;
+	}
+}
+
+void UPulseTween::QueueTweenEvent_Internal(const FGuid& TweenOrSequenceID, EPulseTweenEvent Event, bool bFinal)
+{
+	if (_tweenSubscribers.IsEmpty())
+		return;
+	const TSharedPtr<FPulseTweenNativeEvent>* subscribers = _tweenSubscribers.Find(TweenOrSequenceID);
+	if (!subscribers)
+		return;
+	_pendingTweenEvents.Add({TweenOrSequenceID, Event, *subscribers});
+	// The ID may be reused by another tween: end the subscription now, the queued event keeps the subscribers alive until dispatched.
+	if (bFinal)
+		_tweenSubscribers.Remove(TweenOrSequenceID);
+}
+
+void UPulseTween::DispatchTweenEvents_Internal()
+{
+	if (_pendingTweenEvents.IsEmpty())
+		return;
+	TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Tick::DispatchTweenEvents);
+	// Callbacks can only request changes, applied next tick, so the pending list is stable here.
+	for (const FPulseTweenPendingEvent& pending : _pendingTweenEvents)
+		pending.Subscribers->Broadcast(pending.TweenID, pending.Event);
+	_pendingTweenEvents.Reset();
 }
 
 bool UPulseTween::MustTriggerEvents() const
@@ -486,7 +1125,6 @@ bool UPulseTween::MustTriggerEvents() const
 		_pingPongApexSet.Num() > 0 ||
 		_completedSet.Num() > 0 ||
 		_loopSet.Num() > 0 ||
-		_sequenceChkSet.Num() > 0 ||
 		_sequenceMoveNextSet.Num() > 0 ||
 		_sequenceCompletedSet.Num() > 0;
 }
@@ -511,13 +1149,13 @@ bool UPulseTween::TweenParamsNotEquals(const FTweenParams& Params1, const FTween
 void UPulseTween::DebugTween(FLinearColor Color)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(PulseTween::Debug);
-	if (_tweenInstances.Num() <= 25)
+	if (_tweenTimings.Num() <= 25)
 	{
-		if (_tweenInstances.Num() > 0)
+		if (_tweenTimings.Num() > 0)
 		{
-			for (int i = _tweenInstances.Num() - 1; i >= 0; i--)
+			for (int i = _tweenTimings.Num() - 1; i >= 0; i--)
 			{
-				const auto ins = _tweenInstances[i];
+				const FPulseTweenInstance ins(_tweenTimings[i], _tweenColdData[i]);
 				const FGuid guid = ins.Identifier;
 				UKismetSystemLibrary::PrintString(this, ins.ToString(), true, true, Color, 0, FName(guid.ToString()));
 			}
@@ -531,78 +1169,70 @@ void UPulseTween::DebugTween(FLinearColor Color)
 	else
 	{
 		UKismetSystemLibrary::PrintString(
-			this, FString::Printf(TEXT("%d Actives Tween"), _tweenInstances.Num()), true, true, Color, 0, "ManyActivesTween");
+			this, FString::Printf(TEXT("%d Actives Tween"), _tweenTimings.Num()), true, true, Color, 0, "ManyActivesTween");
 	}
 }
 
+int32 UPulseTween::GetActiveTweenCount() const
+{
+	return _tweenTimings.Num();
+}
+
 bool UPulseTween::IsActiveTween(const FGuid& TweenGUID) const
 {
-	int32 index = _tweenInstances.IndexOfByPredicate([TweenGUID](const FPulseTweenInstance& Tween)-> bool { return Tween.Identifier == TweenGUID; });
-	return index != INDEX_NONE;
+	return FindTweenIndex_Internal(TweenGUID) != INDEX_NONE;
 }
 
 bool UPulseTween::GetTweenValues(const FGuid& TweenGUID, float& OutTweenValue, float& OutTweenPercentage)
 {
-	FPulseTweenInstance tweenInstance = {};
-	const bool success = GetTweenInstance(TweenGUID, tweenInstance);
-	if (success)
-	{
-		OutTweenValue = tweenInstance.GetValue();
-		OutTweenPercentage = tweenInstance.GetTotalDuration() > 0 ? tweenInstance.TotalTime / tweenInstance.GetTotalDuration() : 0.0f;
-		return true;
-	}
-	return false;
+	const int32 index = FindTweenIndex_Internal(TweenGUID);
+	if (index == INDEX_NONE)
+		return false;
+	const FPulseTweenTiming& timing = _tweenTimings[index];
+	OutTweenValue = _tweenValues[index];
+	OutTweenPercentage = timing.GetTotalDuration() > 0 ? timing.TotalTime / timing.GetTotalDuration() : 0.0f;
+	return true;
 }
 
 bool UPulseTween::GetTweenSequenceID(const FGuid& TweenGUID, FGuid& OutSequenceID)
 {
-	const int32 indexOf = _ActiveSequences.IndexOfByPredicate([TweenGUID](const FPulseTweenSequence& sequence)-> bool
-	{
-		return sequence.ContainsTweenAtIndex(TweenGUID) != INDEX_NONE;
-	});
-	if (indexOf == INDEX_NONE)
+	const FGuid* sequenceID = _stepSequenceIDs.Find(TweenGUID);
+	if (!sequenceID)
 		return false;
-	OutSequenceID = _ActiveSequences[indexOf].TweenSequenceID;
+	OutSequenceID = *sequenceID;
 	return true;
 }
 
 bool UPulseTween::GetSequenceCurrentTweenID(const FGuid& SequenceID, FGuid& OutTweenID, int32& OutTweenIndex)
 {
-	const int32 indexOf = _ActiveSequences.IndexOfByPredicate([SequenceID](const FPulseTweenSequence& sequence)-> bool { return sequence.TweenSequenceID == SequenceID; });
-	if (indexOf == INDEX_NONE)
-		return false;
-	FPulseTweenInstance tweenInstance = {};
-	if (!_ActiveSequences[indexOf].GetCurrentInstance(tweenInstance))
+	const FPulseTweenSequence* sequence = FindSequence_Internal(SequenceID);
+	const int32 step = sequence ? sequence->GetCurrentStep() : INDEX_NONE;
+	if (step == INDEX_NONE)
 		return false;
-	OutTweenID = tweenInstance.Identifier;
-	OutTweenIndex = _ActiveSequences[indexOf].InstanceIndex(OutTweenID);
+	OutTweenID = _sequenceStepColdData[step].Identifier;
+	OutTweenIndex = sequence->CurrentIndex;
 	return true;
 }
 
 bool UPulseTween::GetSequenceTweenCount(const FGuid& SequenceID, int32& OutTweenCount)
 {
-	const int32 indexOf = _ActiveSequences.IndexOfByPredicate([SequenceID](const FPulseTweenSequence& sequence)-> bool { return sequence.TweenSequenceID == SequenceID; });
-	if (indexOf == INDEX_NONE)
+	const FPulseTweenSequence* sequence = FindSequence_Internal(SequenceID);
+	if (!sequence)
 		return false;
-	OutTweenCount = _ActiveSequences[indexOf].TweenSequenceInstances.Num();
+	OutTweenCount = sequence->StepCount;
 	return true;
 }
 
 bool UPulseTween::GetTweenSequenceValues(const FGuid& SequenceGUID, float& OutTweenValue, float& OutTweenPercentage, float& OutOverallPercentage)
 {
-	const int32 indexOf = _ActiveSequences.IndexOfByPredicate([SequenceGUID](const FPulseTweenSequence& sequence)-> bool { return sequence.TweenSequenceID == SequenceGUID; });
-	if (indexOf == INDEX_NONE)
+	const FPulseTweenSequence* sequence = FindSequence_Internal(SequenceGUID);
+	const int32 step = sequence ? sequence->GetCurrentStep() : INDEX_NONE;
+	if (step == INDEX_NONE)
 		return false;
-	FPulseTweenInstance tweenInstance = {};
-	if (!_ActiveSequences[indexOf].GetCurrentInstance(tweenInstance))
+	if (!GetTweenValues(_sequenceStepColdData[step].Identifier, OutTweenValue, OutTweenPercentage))
 		return false;
-	if (!GetTweenInstance(tweenInstance.Identifier, tweenInstance))
-		return false;
-	OutTweenValue = tweenInstance.GetValue();
-	OutTweenPercentage = tweenInstance.GetTotalDuration() > 0 ? tweenInstance.TotalTime / tweenInstance.GetTotalDuration() : 0.0f;
-	float unit = 1.0f / _ActiveSequences[indexOf].TweenSequenceInstances.Num();
-	OutOverallPercentage = UPulseSystemLibrary::ArrayIndexPercentage(_ActiveSequences[indexOf].TweenSequenceInstances, _ActiveSequences[indexOf].CurrentIndex, false) + (unit *
-		OutTweenPercentage);
+	const float unit = 1.0f / sequence->StepCount;
+	OutOverallPercentage = unit * (sequence->CurrentIndex + OutTweenPercentage);
 	return true;
 }
 
@@ -624,16 +1254,25 @@ bool UPulseTween::CreateNewSequence(const UObject* Owner, FGuid& OutSequenceID,
 		return false;
 	FPulseTweenSequence tweenSequence = {};
 	tweenSequence.LoopCount = SequenceLoops;
+	tweenSequence.InfiniteLoop = SequenceLoops < 0;
 	tweenSequence.TweenSequenceID = GetTweenNewGuid();
-	tweenSequence.Reset();
+	tweenSequence.FirstStep = _sequenceStepTimings.Num();
+	tweenSequence.StepCount = TweenParams.Num();
+	// Steps are stored ready to start: group and curve resolved once, here.
 	for (int32 i = 0; i < TweenParams.Num(); i++)
 	{
 		FPulseTweenInstance instance = bAttachToOwner? FPulseTweenInstance(Owner, TweenParams[i]) : FPulseTweenInstance(TweenParams[i]);
 		instance.Identifier = GetTweenNewGuid();
-		tweenSequence.TweenSequenceInstances.Add(instance);
+		FPulseTweenTiming& stepTiming = _sequenceStepTimings.Add_GetRef(instance);
+		FPulseTweenColdData& stepColdData = _sequenceStepColdData.Add_GetRef(instance.GetColdData());
+		stepColdData.SequenceID = tweenSequence.TweenSequenceID;
+		stepTiming.Group = FindOrAddTweenGroup_Internal(stepColdData.Group);
+		if (const UCurveFloat* curve = stepColdData.EaseCurve.Get())
+			stepTiming.CurveTable = GetCurveTable_Internal(curve);
+		_stepSequenceIDs.Add(stepColdData.Identifier, tweenSequence.TweenSequenceID);
 	}
-	_newTweensQueue.Enqueue(tweenSequence.TweenSequenceInstances[0]);
-	_ActiveSequences.Add(tweenSequence);
+	_sequenceIndexes.Add(tweenSequence.TweenSequenceID, _ActiveSequences.Add(tweenSequence));
+	EnqueueTween_Internal(FPulseTweenInstance(_sequenceStepTimings[tweenSequence.FirstStep], _sequenceStepColdData[tweenSequence.FirstStep]));
 	OutSequenceID = tweenSequence.TweenSequenceID;
 	return true;
 }
@@ -651,8 +1290,117 @@ FGuid UPulseTween::Tween(const UObject* Owner, const FPulseTweenInstance& TweenI
 		return {};
 	FPulseTweenInstance instance = TweenInstance;
 	instance.Identifier = tweenManager->GetTweenNewGuid();
-	tweenManager->_newTweensQueue.Enqueue(instance);
+	tweenManager->EnqueueTween_Internal(instance);
 	return instance.Identifier;
 }
 
+FGuid UPulseTween::TweenTarget(const UObject* Owner, const FPulseTweenInstance& TweenInstance, const FPulseTweenTarget& Target)
+{
+	if (!Owner || !Owner->GetWorld())
+		return {};
+	auto tweenManager = Owner->GetWorld()->GetSubsystem<UPulseTween>();
+	if (!tweenManager)
+		return {};
+	const FGuid tweenID = Tween(Owner, TweenInstance);
+	if (tweenID.IsValid())
+		tweenManager->_newTweenTargets.Add({tweenID, Target});
+	return tweenID;
+}
+
+bool UPulseTween::CreateNewTargetTween(const UObject* Owner, FGuid& OutTweenID, FTweenParams TweenParams, const FPulseTweenTarget& Target, bool bAttachToOwner)
+{
+	FPulseTweenInstance instance = bAttachToOwner? FPulseTweenInstance(Owner, TweenParams) : FPulseTweenInstance(TweenParams);
+	auto tweenID = TweenTarget(Owner, instance, Target);
+	if (tweenID.IsValid())
+	{
+		OutTweenID = tweenID;
+		return true;
+	}
+	return false;
+}
+
+FPulseTweenTarget UPulseTween::MakeActorTransformTarget(AActor* Actor, const FTransform& From, const FTransform& To)
+{
+	FPulseTweenTarget target;
+	target.Type = EPulseTweenTargetType::ActorTransform;
+	target.Object = Actor;
+	target.FromTransform = From;
+	target.ToTransform = To;
+	return target;
+}
+
+FPulseTweenTarget UPulseTween::MakeComponentTransformTarget(USceneComponent* Component, const FTransform& From, const FTransform& To)
+{
+	FPulseTweenTarget target;
+	target.Type = EPulseTweenTargetType::ComponentTransform;
+	target.Object = Component;
+	target.FromTransform = From;
+	target.ToTransform = To;
+	return target;
+}
+
+FPulseTweenTarget UPulseTween::MakeRelativeLocationTarget(USceneComponent* Component, const FVector& From, const FVector& To)
+{
+	FPulseTweenTarget target;
+	target.Type = EPulseTweenTargetType::RelativeLocation;
+	target.Object = Component;
+	target.FromValue = FVector4(From, 0);
+	target.ToValue = FVector4(To, 0);
+	return target;
+}
+
+FPulseTweenTarget UPulseTween::MakeMaterialScalarTarget(UMaterialInstanceDynamic* Material, FName ParameterName, float From, float To)
+{
+	FPulseTweenTarget target;
+	target.Type = EPulseTweenTargetType::MaterialScalar;
+	target.Object = Material;
+	target.Path = ParameterName.ToString();
+	target.FromValue.X = From;
+	target.ToValue.X = To;
+	return target;
+}
 
+FPulseTweenTarget UPulseTween::MakeMaterialVectorTarget(UMaterialInstanceDynamic* Material, FName ParameterName, const FLinearColor& From, const FLinearColor& To)
+{
+	FPulseTweenTarget target;
+	target.Type = EPulseTweenTargetType::MaterialVector;
+	target.Object = Material;
+	target.Path = ParameterName.ToString();
+	target.FromValue = FVector4(From);
+	target.ToValue = FVector4(To);
+	return target;
+}
+
+FPulseTweenTarget UPulseTween::MakeWidgetOpacityTarget(UWidget* Widget, float From, float To)
+{
+	FPulseTweenTarget target;
+	target.Type = EPulseTweenTargetType::WidgetOpacity;
+	target.Object = Widget;
+	target.FromValue.X = From;
+	target.ToValue.X = To;
+	return target;
+}
+
+FPulseTweenTarget UPulseTween::MakeWidgetTransformTarget(UWidget* Widget, FVector2D FromTranslation, FVector2D ToTranslation, FVector2D FromScale, FVector2D ToScale, float FromAngle,
+                                                         float ToAngle)
+{
+	FPulseTweenTarget target;
+	target.Type = EPulseTweenTargetType::WidgetTransform;
+	target.Object = Widget;
+	target.FromTransform = FTransform(FQuat::Identity, FVector(FromTranslation, 0), FVector(FromScale, 1));
+	target.ToTransform = FTransform(FQuat::Identity, FVector(ToTranslation, 0), FVector(ToScale, 1));
+	target.FromValue.X = FromAngle;
+	target.ToValue.X = ToAngle;
+	return target;
+}
+
+FPulseTweenTarget UPulseTween::MakePropertyTarget(UObject* Object, const FString& PropertyPath, const FVector4& From, const FVector4& To)
+{
+	FPulseTweenTarget target;
+	target.Type = EPulseTweenTargetType::Property;
+	target.Object = Object;
+	target.Path = PropertyPath;
+	target.FromValue = From;
+	target.ToValue = To;
+	return target;
+}
@@ -13,13 +13,71 @@ UPulseTweenEventListener::UPulseTweenEventListener()
 }
 
 
-void UPulseTweenEventListener::PostInitProperties()
+void UPulseTweenEventListener::BeginPlay()
 {
-	Super::PostInitProperties();
+	Super::BeginPlay();
+	// Bound at begin play, once the instance's settings are loaded and the world is up.
+	if (bListenToAllTweens)
+		BindGlobalEvents_Internal(true);
+}
+
+void UPulseTweenEventListener::BeginDestroy()
+{
+	Super::BeginDestroy();
 	auto world = GetWorld();
 	if (!world)
 		return;
 	if (auto tweenSubSystem = world->GetSubsystem<UPulseTween>())
+	{
+		for (const FGuid& id : _listenedTweens)
+			tweenSubSystem->UnsubscribeFromTween(id, this);
+	}
+	_listenedTweens.Empty();
+	BindGlobalEvents_Internal(false);
+}
+
+bool UPulseTweenEventListener::ListenToTween(const FGuid& TweenOrSequenceID)
+{
+	auto world = GetWorld();
+	if (!world || _listenedTweens.Contains(TweenOrSequenceID))
+		return false;
+	auto tweenSubSystem = world->GetSubsystem<UPulseTween>();
+	if (!tweenSubSystem)
+		return false;
+	if (!tweenSubSystem->SubscribeToTween(TweenOrSequenceID, FPulseTweenNativeEvent::FDelegate::CreateUObject(this, &UPulseTweenEventListener::OnTweenEvent_Func)).IsValid())
+		return false;
+	_listenedTweens.Add(TweenOrSequenceID);
+	return true;
+}
+
+bool UPulseTweenEventListener::StopListeningToTween(const FGuid& TweenOrSequenceID)
+{
+	if (_listenedTweens.Remove(TweenOrSequenceID) <= 0)
+		return false;
+	auto world = GetWorld();
+	if (!world)
+		return false;
+	auto tweenSubSystem = world->GetSubsystem<UPulseTween>();
+	return tweenSubSystem && tweenSubSystem->UnsubscribeFromTween(TweenOrSequenceID, this);
+}
+
+void UPulseTweenEventListener::OnTweenEvent_Func(const FGuid& TweenID, EPulseTweenEvent Event)
+{
+	// The subscription ends with the tween or the sequence.
+	if (Event == EPulseTweenEvent::Completed || Event == EPulseTweenEvent::Cancelled || Event == EPulseTweenEvent::SequenceCompleted)
+		_listenedTweens.Remove(TweenID);
+	OnTweenEvent.Broadcast(TweenID, Event);
+}
+
+void UPulseTweenEventListener::BindGlobalEvents_Internal(bool bBind)
+{
+	auto world = GetWorld();
+	if (!world)
+		return;
+	auto tweenSubSystem = world->GetSubsystem<UPulseTween>();
+	if (!tweenSubSystem)
+		return;
+	if (bBind)
 	{
 		tweenSubSystem->OnTweenUpdateEvent.AddDynamic(this, &UPulseTweenEventListener::OnTweenUpdateEvent_Func);
 		tweenSubSystem->OnTweenStartedEvent.AddDynamic(this, &UPulseTweenEventListener::OnTweenStartedEvent_Func);
@@ -30,17 +88,9 @@ void UPulseTweenEventListener::PostInitProperties()
 		tweenSubSystem->OnTweenPingPongApexEvent.AddDynamic(this, &UPulseTweenEventListener::OnTweenPingPongApexEvent_Func);
 		tweenSubSystem->OnTweenLoopEvent.AddDynamic(this, &UPulseTweenEventListener::OnTweenLoopEvent_Func);
 		tweenSubSystem->OnTweenSequenceMoveNextEvent.AddDynamic(this, &UPulseTweenEventListener::OnTweenSequenceMoveNextEvent_Func);
-		tweenSubSystem->OnTweenSequenceCompletedEvent.AddDynamic(this, &UPulseTweenEventListener::OnTweenCompletedEvent_Func);
+		tweenSubSystem->OnTweenSequenceCompletedEvent.AddDynamic(this, &UPulseTweenEventListener::OnTweenSequenceCompletedEvent_Func);
 	}
-}
-
-void UPulseTweenEventListener::BeginDestroy()
-{
-	Super::BeginDestroy();
-	auto world = GetWorld();
-	if (!world)
-		return;
-	if (auto tweenSubSystem = world->GetSubsystem<UPulseTween>())
+	else
 	{
 		tweenSubSystem->OnTweenUpdateEvent.RemoveDynamic(this, &UPulseTweenEventListener::OnTweenUpdateEvent_Func);
 		tweenSubSystem->OnTweenStartedEvent.RemoveDynamic(this, &UPulseTweenEventListener::OnTweenStartedEvent_Func);
@@ -51,7 +101,7 @@ void UPulseTweenEventListener::BeginDestroy()
 		tweenSubSystem->OnTweenPingPongApexEvent.RemoveDynamic(this, &UPulseTweenEventListener::OnTweenPingPongApexEvent_Func);
 		tweenSubSystem->OnTweenLoopEvent.RemoveDynamic(this, &UPulseTweenEventListener::OnTweenLoopEvent_Func);
 		tweenSubSystem->OnTweenSequenceMoveNextEvent.RemoveDynamic(this, &UPulseTweenEventListener::OnTweenSequenceMoveNextEvent_Func);
-		tweenSubSystem->OnTweenSequenceCompletedEvent.RemoveDynamic(this, &UPulseTweenEventListener::OnTweenCompletedEvent_Func);
+		tweenSubSystem->OnTweenSequenceCompletedEvent.RemoveDynamic(this, &UPulseTweenEventListener::OnTweenSequenceCompletedEvent_Func);
 	}
 }
 
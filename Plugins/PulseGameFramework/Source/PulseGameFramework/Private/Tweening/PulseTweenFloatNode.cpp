@@ -6,90 +6,71 @@
 #include "PulseGameFramework.h"
 
 
-void UPulseTweenFloatNode::OnUpdate_Internal(TSet<FGuid> Set)
+void UPulseTweenFloatNode::OnTweenEvent_Internal(const FGuid& ID, EPulseTweenEvent Event)
 {
-	if (!Set.Contains(TweenGUID))
-		return;
-	float Value = 0;
-	float Percentage = 0;
-	if (!TweenManager)
-		return;
-	if (!TweenManager->GetTweenValues(TweenGUID, Value, Percentage))
-		return;
-	OnTweenUpdate.Broadcast(Value, Percentage);
-}
-
-void UPulseTweenFloatNode::OnStarted_Internal(TSet<FGuid> Set)
-{
-	if (!Set.Contains(TweenGUID))
-		return;
-	OnTweenStarted.Broadcast();
-}
-
-void UPulseTweenFloatNode::OnPaused_Internal(TSet<FGuid> Set)
-{
-	if (!Set.Contains(TweenGUID))
-		return;
-	OnTweenPaused.Broadcast();
-}
-
-void UPulseTweenFloatNode::OnResumed_Internal(TSet<FGuid> Set)
-{
-	if (!Set.Contains(TweenGUID))
-		return;
-	OnTweenResumed.Broadcast();
-}
-
-void UPulseTweenFloatNode::OnPingPong_Internal(TSet<FGuid> Set)
-{
-	if (!Set.Contains(TweenGUID))
-		return;
-	OnTweenPingPongApex.Broadcast();
-}
-
-void UPulseTweenFloatNode::OnLooped_Internal(TSet<FGuid> Set)
-{
-	if (!Set.Contains(TweenGUID))
-		return;
-	OnTweenLooped.Broadcast();
-}
-
-void UPulseTweenFloatNode::OnCompleted_Internal(TSet<FGuid> Set)
-{
-	if (!Set.Contains(TweenGUID))
-		return;
-	OnTweenCompleted.Broadcast();
-	if (!SequenceGUID.IsValid())
+	switch (Event)
+	{
+	case EPulseTweenEvent::Update:
+		{
+			float Value = 0;
+			float Percentage = 0;
+			if (!TweenManager)
+				return;
+			if (!TweenManager->GetTweenValues(TweenGUID, Value, Percentage))
+				return;
+			OnTweenUpdate.Broadcast(Value, Percentage);
+		}
+		break;
+	case EPulseTweenEvent::Started:
+		OnTweenStarted.Broadcast();
+		break;
+	case EPulseTweenEvent::Paused:
+		OnTweenPaused.Broadcast();
+		break;
+	case EPulseTweenEvent::Resumed:
+		OnTweenResumed.Broadcast();
+		break;
+	case EPulseTweenEvent::PingPongApex:
+		OnTweenPingPongApex.Broadcast();
+		break;
+	case EPulseTweenEvent::Looped:
+		OnTweenLooped.Broadcast();
+		break;
+	case EPulseTweenEvent::Completed:
+		OnTweenCompleted.Broadcast();
+		if (!SequenceGUID.IsValid())
+			SetReadyToDestroy();
+		break;
+	case EPulseTweenEvent::Cancelled:
+		OnTweenCancelled.Broadcast();
+		if (!SequenceGUID.IsValid())
+			SetReadyToDestroy();
+		break;
+	case EPulseTweenEvent::SequenceMoveNext:
+		{
+			if (!TweenManager)
+				return;
+			auto old = TweenGUID;
+			int32 index = -1;
+			TweenManager->GetSequenceCurrentTweenID(SequenceGUID, TweenGUID, index);
+			UE_LOG(LogPulseTweening, Log, TEXT("Node Tween UID from %s to %s"), *old.ToString(), *TweenGUID.ToString());
+			// The previous tween's subscription ended with it, follow the new one.
+			TweenManager->UnsubscribeFromTween(old, _tweenSubscription);
+			SubscribeToCurrentTween_Internal();
+		}
+		break;
+	case EPulseTweenEvent::SequenceCompleted:
+		OnSequenceCompleted.Broadcast();
 		SetReadyToDestroy();
+		break;
+	}
 }
 
-void UPulseTweenFloatNode::OnSequenceMoveNext_Internal(TSet<FGuid> Set)
-{
-	if (!Set.Contains(SequenceGUID))
-		return;
-	if (!TweenManager)
-		return;
-	auto old = TweenGUID;
-	int32 index = -1;
-	TweenManager->GetSequenceCurrentTweenID(SequenceGUID, TweenGUID, index);
-	UE_LOG(LogPulseTweening, Log, TEXT("Node Tween UID from %s to %s"), *old.ToString(), *TweenGUID.ToString());
-}
-
-void UPulseTweenFloatNode::OnSequenceCompleted_Internal(TSet<FGuid> Set)
-{
-	if (!Set.Contains(SequenceGUID))
-		return;
-	OnSequenceCompleted.Broadcast();
-	SetReadyToDestroy();
-}
-
-void UPulseTweenFloatNode::OnCancelled_Internal(TSet<FGuid> Set)
+void UPulseTweenFloatNode::SubscribeToCurrentTween_Internal()
 {
-	if (!Set.Contains(TweenGUID))
+	if (!TweenManager || !TweenGUID.IsValid())
 		return;
-	OnTweenCancelled.Broadcast();
-	if (!SequenceGUID.IsValid())
-		SetReadyToDestroy();
+	_tweenSubscription = TweenManager->SubscribeToTween(TweenGUID, FPulseTweenNativeEvent::FDelegate::CreateUObject(this, &UPulseTweenFloatNode::OnTweenEvent_Internal));
 }
 
 void UPulseTweenFloatNode::Activate()
@@ -135,19 +116,9 @@ void UPulseTweenFloatNode::Activate()
 	}
 	if (TweenGUID.IsValid())
 	{
-		TweenManager->OnTweenUpdateEvent.AddDynamic(this, &UPulseTweenFloatNode::OnUpdate_Internal);
-		TweenManager->OnTweenStartedEvent.AddDynamic(this, &UPulseTweenFloatNode::OnStarted_Internal);
-		TweenManager->OnTweenPausedEvent.AddDynamic(this, &UPulseTweenFloatNode::OnPaused_Internal);
-		TweenManager->OnTweenResumedEvent.AddDynamic(this, &UPulseTweenFloatNode::OnResumed_Internal);
-		TweenManager->OnTweenPingPongApexEvent.AddDynamic(this, &UPulseTweenFloatNode::OnPingPong_Internal);
-		TweenManager->OnTweenLoopEvent.AddDynamic(this, &UPulseTweenFloatNode::OnLooped_Internal);
-		TweenManager->OnTweenCompletedEvent.AddDynamic(this, &UPulseTweenFloatNode::OnCompleted_Internal);
-		TweenManager->OnTweenCancelledEvent.AddDynamic(this, &UPulseTweenFloatNode::OnCancelled_Internal);
+		SubscribeToCurrentTween_Internal();
 		if (SequenceGUID.IsValid())
-		{
-			TweenManager->OnTweenSequenceCompletedEvent.AddDynamic(this, &UPulseTweenFloatNode::OnSequenceCompleted_Internal);
-			TweenManager->OnTweenSequenceMoveNextEvent.AddDynamic(this, &UPulseTweenFloatNode::OnSequenceMoveNext_Internal);
-		}
+			_sequenceSubscription = TweenManager->SubscribeToTween(SequenceGUID, FPulseTweenNativeEvent::FDelegate::CreateUObject(this, &UPulseTweenFloatNode::OnTweenEvent_Internal));
 	}
 	else
 	{
@@ -157,18 +128,10 @@ void UPulseTweenFloatNode::Activate()
 
 void UPulseTweenFloatNode::BeginDestroy()
 {
-	if (TweenManager)
+	if (IsValid(TweenManager))
 	{
-		TweenManager->OnTweenUpdateEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnUpdate_Internal);
-		TweenManager->OnTweenStartedEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnStarted_Internal);
-		TweenManager->OnTweenPausedEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnPaused_Internal);
-		TweenManager->OnTweenResumedEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnResumed_Internal);
-		TweenManager->OnTweenPingPongApexEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnPingPong_Internal);
-		TweenManager->OnTweenLoopEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnLooped_Internal);
-		TweenManager->OnTweenCompletedEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnCompleted_Internal);
-		TweenManager->OnTweenCancelledEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnCancelled_Internal);
-		TweenManager->OnTweenSequenceCompletedEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnSequenceCompleted_Internal);
-		TweenManager->OnTweenSequenceMoveNextEvent.RemoveDynamic(this, &UPulseTweenFloatNode::OnSequenceMoveNext_Internal);
+		TweenManager->UnsubscribeFromTween(TweenGUID, _tweenSubscription);
+		TweenManager->UnsubscribeFromTween(SequenceGUID, _sequenceSubscription);
 	}
 	Super::BeginDestroy();
 }
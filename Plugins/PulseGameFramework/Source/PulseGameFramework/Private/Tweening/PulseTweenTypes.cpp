@@ -0,0 +1,429 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+
+#include "Tweening/PulseTweenTypes.h"
+#include "Curves/CurveFloat.h"
+#include "Misc/ScopeLock.h"
+
+
+namespace PulseEaseSimd
+{
+	// Apply Function on the inputs, four at a time. VectorCount must be a multiple of 4.
+	template <typename FunctionType>
+	FORCEINLINE void ForEachLane(const float* InTimes, float* OutValues, int32 VectorCount, FunctionType&& Function)
+	{
+		for (int32 i = 0; i < VectorCount; i += 4)
+		{
+			VectorStore(Function(VectorLoad(InTimes + i)), OutValues + i);
+		}
+	}
+
+	FORCEINLINE VectorRegister4Float Pow(const VectorRegister4Float& X, int32 N)
+	{
+		VectorRegister4Float result = X;
+		for (int32 i = 1; i < N; i++)
+			result = VectorMultiply(result, X);
+		return result;
+	}
+
+	// 0 at or before t = 0, 1 at or after t = 1, Value in between. Matches the scalar expo eases.
+	FORCEINLINE VectorRegister4Float EdgeClamp(const VectorRegister4Float& T, const VectorRegister4Float& Value)
+	{
+		const VectorRegister4Float inner = VectorSelect(VectorCompareGE(T, VectorOneFloat()), VectorOneFloat(), Value);
+		return VectorSelect(VectorCompareLE(T, VectorZeroFloat()), VectorZeroFloat(), inner);
+	}
+
+	FORCEINLINE VectorRegister4Float SafeSqrt(const VectorRegister4Float& X)
+	{
+		return VectorSqrt(VectorMax(X, VectorZeroFloat()));
+	}
+
+	// Power of the Quad to Quint eases, 0 if not one of them.
+	FORCEINLINE int32 GetPolynomialDegree(EPulseTweenEase Ease)
+	{
+		switch (Ease)
+		{
+		case EPulseTweenEase::InQuad:
+		case EPulseTweenEase::OutQuad:
+		case EPulseTweenEase::InOutQuad:
+			return 2;
+		case EPulseTweenEase::InCubic:
+		case EPulseTweenEase::OutCubic:
+		case EPulseTweenEase::InOutCubic:
+			return 3;
+		case EPulseTweenEase::InQuart:
+		case EPulseTweenEase::OutQuart:
+		case EPulseTweenEase::InOutQuart:
+			return 4;
+		case EPulseTweenEase::InQuint:
+		case EPulseTweenEase::OutQuint:
+		case EPulseTweenEase::InOutQuint:
+			return 5;
+		default:
+			return 0;
+		}
+	}
+}
+
+
+float FPulseEaseEvaluator::Evaluate(EPulseTweenEase Ease, float t) const
+{
+	switch (Ease)
+	{
+	default:
+		return t;
+	case EPulseTweenEase::Linear:
+		return EaseLinear(t);
+	case EPulseTweenEase::Smoothstep:
+		return EaseSmoothstep(t);
+	case EPulseTweenEase::Stepped:
+		return EaseStepped(t);
+	case EPulseTweenEase::InSine:
+		return EaseInSine(t);
+	case EPulseTweenEase::OutSine:
+		return EaseOutSine(t);
+	case EPulseTweenEase::InOutSine:
+		return EaseInOutSine(t);
+	case EPulseTweenEase::InQuad:
+		return EaseInQuad(t);
+	case EPulseTweenEase::OutQuad:
+		return EaseOutQuad(t);
+	case EPulseTweenEase::InOutQuad:
+		return EaseInOutQuad(t);
+	case EPulseTweenEase::InCubic:
+		return EaseInCubic(t);
+	case EPulseTweenEase::OutCubic:
+		return EaseOutCubic(t);
+	case EPulseTweenEase::InOutCubic:
+		return EaseInOutCubic(t);
+	case EPulseTweenEase::InQuart:
+		return EaseInQuart(t);
+	case EPulseTweenEase::OutQuart:
+		return EaseOutQuart(t);
+	case EPulseTweenEase::InOutQuart:
+		return EaseInOutQuart(t);
+	case EPulseTweenEase::InQuint:
+		return EaseInQuint(t);
+	case EPulseTweenEase::OutQuint:
+		return EaseOutQuint(t);
+	case EPulseTweenEase::InOutQuint:
+		return EaseInOutQuint(t);
+	case EPulseTweenEase::InExpo:
+		return EaseInExpo(t);
+	case EPulseTweenEase::OutExpo:
+		return EaseOutExpo(t);
+	case EPulseTweenEase::InOutExpo:
+		return EaseInOutExpo(t);
+	case EPulseTweenEase::InCirc:
+		return EaseInCirc(t);
+	case EPulseTweenEase::OutCirc:
+		return EaseOutCirc(t);
+	case EPulseTweenEase::InOutCirc:
+		return EaseInOutCirc(t);
+	case EPulseTweenEase::InElastic:
+		return EaseInElastic(t);
+	case EPulseTweenEase::OutElastic:
+		return EaseOutElastic(t);
+	case EPulseTweenEase::InOutElastic:
+		return EaseInOutElastic(t);
+	case EPulseTweenEase::InBounce:
+		return EaseInBounce(t);
+	case EPulseTweenEase::OutBounce:
+		return EaseOutBounce(t);
+	case EPulseTweenEase::InOutBounce:
+		return EaseInOutBounce(t);
+	case EPulseTweenEase::InBack:
+		return EaseInBack(t);
+	case EPulseTweenEase::OutBack:
+		return EaseOutBack(t);
+	case EPulseTweenEase::InOutBack:
+		return EaseInOutBack(t);
+	}
+}
+
+void FPulseEaseEvaluator::EvaluateBatch(EPulseTweenEase Ease, const float* InTimes, float* OutValues, int32 Count) const
+{
+	using namespace PulseEaseSimd;
+	if (Count <= 0 || !InTimes || !OutValues)
+		return;
+	// Stepped, Elastic and Bounce are piecewise or periodic, they stay on the scalar path. So are the last Count % 4 values.
+	const int32 vectorCount = Count & ~3;
+	const VectorRegister4Float zero = VectorZeroFloat();
+	const VectorRegister4Float one = VectorOneFloat();
+	const VectorRegister4Float half = VectorSetFloat1(.5f);
+	const VectorRegister4Float two = VectorSetFloat1(2);
+	int32 scalarStart = vectorCount;
+
+	switch (Ease)
+	{
+	case EPulseTweenEase::Linear:
+		FMemory::Memcpy(OutValues, InTimes, vectorCount * sizeof(float));
+		break;
+	case EPulseTweenEase::Smoothstep:
+		{
+			const VectorRegister4Float x0 = VectorSetFloat1(SmoothStepX0);
+			const VectorRegister4Float invRange = VectorSetFloat1(1.0f / (SmoothStepX1 - SmoothStepX0));
+			const VectorRegister4Float three = VectorSetFloat1(3);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+			{
+				const VectorRegister4Float x = VectorMin(VectorMax(VectorMultiply(VectorSubtract(t, x0), invRange), zero), one);
+				return VectorMultiply(VectorMultiply(x, x), VectorSubtract(three, VectorMultiply(two, x)));
+			});
+		}
+		break;
+	case EPulseTweenEase::InSine:
+	case EPulseTweenEase::OutSine:
+	case EPulseTweenEase::InOutSine:
+		{
+			const VectorRegister4Float halfPi = VectorSetFloat1(PI * .5f);
+			const VectorRegister4Float pi = VectorSetFloat1(PI);
+			if (Ease == EPulseTweenEase::InSine)
+				ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t) { return VectorSubtract(one, VectorCos(VectorMultiply(t, halfPi))); });
+			else if (Ease == EPulseTweenEase::OutSine)
+				ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t) { return VectorSin(VectorMultiply(t, halfPi)); });
+			else
+				ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t) { return VectorMultiply(half, VectorSubtract(one, VectorCos(VectorMultiply(t, pi)))); });
+		}
+		break;
+	case EPulseTweenEase::InQuad:
+	case EPulseTweenEase::InCubic:
+	case EPulseTweenEase::InQuart:
+	case EPulseTweenEase::InQuint:
+		{
+			const int32 degree = GetPolynomialDegree(Ease);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t) { return Pow(t, degree); });
+		}
+		break;
+	case EPulseTweenEase::OutQuad:
+	case EPulseTweenEase::OutCubic:
+	case EPulseTweenEase::OutQuart:
+	case EPulseTweenEase::OutQuint:
+		{
+			// 1 - (1 - t)^n
+			const int32 degree = GetPolynomialDegree(Ease);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t) { return VectorSubtract(one, Pow(VectorSubtract(one, t), degree)); });
+		}
+		break;
+	case EPulseTweenEase::InOutQuad:
+	case EPulseTweenEase::InOutCubic:
+	case EPulseTweenEase::InOutQuart:
+	case EPulseTweenEase::InOutQuint:
+		{
+			// k * t^n in the first half, 1 - k * (1 - t)^n in the second, with k = 2^(n-1)
+			const int32 degree = GetPolynomialDegree(Ease);
+			const VectorRegister4Float k = VectorSetFloat1(static_cast<float>(1 << (degree - 1)));
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+			{
+				const VectorRegister4Float first = VectorMultiply(k, Pow(t, degree));
+				const VectorRegister4Float second = VectorSubtract(one, VectorMultiply(k, Pow(VectorSubtract(one, t), degree)));
+				return VectorSelect(VectorCompareLT(t, half), first, second);
+			});
+		}
+		break;
+	case EPulseTweenEase::InExpo:
+		{
+			const VectorRegister4Float ten = VectorSetFloat1(10);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+			{
+				return EdgeClamp(t, VectorExp2(VectorMultiply(ten, VectorSubtract(t, one))));
+			});
+		}
+		break;
+	case EPulseTweenEase::OutExpo:
+		{
+			const VectorRegister4Float minusTen = VectorSetFloat1(-10);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+			{
+				return EdgeClamp(t, VectorSubtract(one, VectorExp2(VectorMultiply(minusTen, t))));
+			});
+		}
+		break;
+	case EPulseTweenEase::InOutExpo:
+		{
+			// 2^(20t - 11) in the first half, 1 - 2^(9 - 20t) in the second
+			const VectorRegister4Float twenty = VectorSetFloat1(20);
+			const VectorRegister4Float eleven = VectorSetFloat1(11);
+			const VectorRegister4Float nine = VectorSetFloat1(9);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+			{
+				const VectorRegister4Float t20 = VectorMultiply(twenty, t);
+				const VectorRegister4Float first = VectorExp2(VectorSubtract(t20, eleven));
+				const VectorRegister4Float second = VectorSubtract(one, VectorExp2(VectorSubtract(nine, t20)));
+				return EdgeClamp(t, VectorSelect(VectorCompareLT(t, half), first, second));
+			});
+		}
+		break;
+	case EPulseTweenEase::InCirc:
+		ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+		{
+			return VectorSubtract(one, SafeSqrt(VectorSubtract(one, VectorMultiply(t, t))));
+		});
+		break;
+	case EPulseTweenEase::OutCirc:
+		ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+		{
+			const VectorRegister4Float m = VectorSubtract(t, one);
+			return SafeSqrt(VectorSubtract(one, VectorMultiply(m, m)));
+		});
+		break;
+	case EPulseTweenEase::InOutCirc:
+		{
+			const VectorRegister4Float four = VectorSetFloat1(4);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+			{
+				const VectorRegister4Float t2 = VectorMultiply(two, t);
+				const VectorRegister4Float m = VectorSubtract(t, one);
+				const VectorRegister4Float first = VectorMultiply(half, VectorSubtract(one, SafeSqrt(VectorSubtract(one, VectorMultiply(t2, t2)))));
+				const VectorRegister4Float second = VectorMultiply(half, VectorAdd(SafeSqrt(VectorSubtract(one, VectorMultiply(four, VectorMultiply(m, m)))), one));
+				return VectorSelect(VectorCompareLT(t, half), first, second);
+			});
+		}
+		break;
+	case EPulseTweenEase::InBack:
+		{
+			const VectorRegister4Float overshoot = VectorSetFloat1(Overshoot);
+			const VectorRegister4Float overshootPlusOne = VectorSetFloat1(Overshoot + 1);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+			{
+				return VectorMultiply(VectorMultiply(t, t), VectorSubtract(VectorMultiply(overshootPlusOne, t), overshoot));
+			});
+		}
+		break;
+	case EPulseTweenEase::OutBack:
+		{
+			const VectorRegister4Float overshoot = VectorSetFloat1(Overshoot);
+			const VectorRegister4Float overshootPlusOne = VectorSetFloat1(Overshoot + 1);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+			{
+				const VectorRegister4Float m = VectorSubtract(t, one);
+				return VectorAdd(one, VectorMultiply(VectorMultiply(m, m), VectorMultiplyAdd(m, overshootPlusOne, overshoot)));
+			});
+		}
+		break;
+	case EPulseTweenEase::InOutBack:
+		{
+			const float s = Overshoot * BACK_INOUT_OVERSHOOT_MODIFIER;
+			const VectorRegister4Float overshoot = VectorSetFloat1(s);
+			const VectorRegister4Float overshootPlusOne = VectorSetFloat1(s + 1);
+			ForEachLane(InTimes, OutValues, vectorCount, [&](const VectorRegister4Float& t)
+			{
+				const VectorRegister4Float t2 = VectorMultiply(two, t);
+				const VectorRegister4Float m = VectorSubtract(t, one);
+				const VectorRegister4Float m2 = VectorMultiply(two, m);
+				const VectorRegister4Float first = VectorMultiply(VectorMultiply(t, t2), VectorSubtract(VectorMultiply(t2, overshootPlusOne), overshoot));
+				const VectorRegister4Float second = VectorAdd(one, VectorMultiply(VectorMultiply(two, VectorMultiply(m, m)), VectorMultiplyAdd(m2, overshootPlusOne, overshoot)));
+				return VectorSelect(VectorCompareLT(t, half), first, second);
+			});
+		}
+		break;
+	default:
+		scalarStart = 0;
+		break;
+	}
+
+	for (int32 i = scalarStart; i < Count; i++)
+	{
+		OutValues[i] = Evaluate(Ease, InTimes[i]);
+	}
+}
+
+
+void FPulseEaseLUT::EvaluateBatch(const float* InTimes, float* OutValues, int32 Count) const
+{
+	const float* samples = Samples.GetData();
+	const int32 lastSegment = Samples.Num() - 2;
+	const float scale = Samples.Num() - 1;
+	for (int32 i = 0; i < Count; i++)
+	{
+		const float x = FMath::Clamp(InTimes[i], 0.0f, 1.0f) * scale;
+		const int32 index = FMath::Min(static_cast<int32>(x), lastSegment);
+		const float a = samples[index];
+		OutValues[i] = a + (samples[index + 1] - a) * (x - index);
+	}
+}
+
+bool FPulseEaseLUT::IsWorthTable(EPulseTweenEase Ease)
+{
+	switch (Ease)
+	{
+	case EPulseTweenEase::InSine:
+	case EPulseTweenEase::OutSine:
+	case EPulseTweenEase::InOutSine:
+	case EPulseTweenEase::InExpo:
+	case EPulseTweenEase::OutExpo:
+	case EPulseTweenEase::InOutExpo:
+	case EPulseTweenEase::InCirc:
+	case EPulseTweenEase::OutCirc:
+	case EPulseTweenEase::InOutCirc:
+	case EPulseTweenEase::InElastic:
+	case EPulseTweenEase::OutElastic:
+	case EPulseTweenEase::InOutElastic:
+	case EPulseTweenEase::InBounce:
+	case EPulseTweenEase::OutBounce:
+	case EPulseTweenEase::InOutBounce:
+		return true;
+	default:
+		return false;
+	}
+}
+
+FPulseEaseLUT FPulseEaseLUT::Bake(const FPulseEaseEvaluator& Evaluator, EPulseTweenEase Ease, int32 SampleCount)
+{
+	FPulseEaseLUT table;
+	const int32 count = FMath::Clamp(SampleCount, MinSamples, MaxSamples);
+	table.Samples.SetNumUninitialized(count);
+	for (int32 i = 0; i < count; i++)
+		table.Samples[i] = Evaluator.Evaluate(Ease, static_cast<float>(i) / (count - 1));
+	return table;
+}
+
+FPulseEaseLUT FPulseEaseLUT::Bake(const UCurveFloat* Curve, int32 SampleCount)
+{
+	FPulseEaseLUT table;
+	const int32 count = FMath::Clamp(SampleCount, MinSamples, MaxSamples);
+	table.Samples.SetNumUninitialized(count);
+	for (int32 i = 0; i < count; i++)
+		table.Samples[i] = EvaluateCurve(Curve, static_cast<float>(i) / (count - 1));
+	return table;
+}
+
+float FPulseEaseLUT::EvaluateCurve(const UCurveFloat* Curve, float t)
+{
+	if (!Curve)
+		return t;
+	float minTime = 0, maxTime = 1;
+	Curve->GetTimeRange(minTime, maxTime);
+	if (maxTime <= minTime)
+		return Curve->GetFloatValue(minTime);
+	return Curve->GetFloatValue(FMath::Lerp(minTime, maxTime, FMath::Clamp(t, 0.0f, 1.0f)));
+}
+
+TSharedRef<const FPulseEaseLUT> FPulseEaseLUT::GetShared(const FPulseEaseEvaluator& Evaluator, EPulseTweenEase Ease, int32 SampleCount)
+{
+	struct FTableKey
+	{
+		FPulseEaseEvaluator Evaluator;
+		EPulseTweenEase Ease;
+		int32 SampleCount;
+
+		bool operator==(const FTableKey& Other) const { return Evaluator == Other.Evaluator && Ease == Other.Ease && SampleCount == Other.SampleCount; }
+		friend uint32 GetTypeHash(const FTableKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Evaluator), HashCombine(GetTypeHash(Key.Ease), GetTypeHash(Key.SampleCount)));
+		}
+	};
+
+	static FCriticalSection tablesLock;
+	static TMap<FTableKey, TWeakPtr<const FPulseEaseLUT>> sharedTables;
+
+	const FTableKey key{Evaluator, Ease, FMath::Clamp(SampleCount, MinSamples, MaxSamples)};
+	FScopeLock lock(&tablesLock);
+	if (const auto existing = sharedTables.Find(key))
+	{
+		if (const auto table = existing->Pin())
+			return table.ToSharedRef();
+	}
+	TSharedRef<const FPulseEaseLUT> table = MakeShared<const FPulseEaseLUT>(Bake(Evaluator, Ease, key.SampleCount));
+	sharedTables.Add(key, table);
+	return table;
+}
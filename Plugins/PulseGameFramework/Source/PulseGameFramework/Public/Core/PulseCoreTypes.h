@@ -53,6 +53,15 @@ enum class EUserProfileStatus : uint8
 	LoggedIn = 2 UMETA(DisplayName = "LoggedIn user")
 };
 
+// The hash used to verify downloads as they arrive
+UENUM(BlueprintType)
+enum class EPulseDownloadHash : uint8
+{
+	None = 0 UMETA(DisplayName = "No verification"),
+	MD5 = 1 UMETA(DisplayName = "MD5"),
+	XxHash64 = 2 UMETA(DisplayName = "XxHash64", ToolTip = "Faster, non cryptographic. For trusted LAN or CDN sources"),
+};
+
 
 #pragma endregion Enums
 
@@ -241,6 +250,35 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Pooling System")
 	int32 GlobalPoolLimit = 100;
 
+	// How many pooled entries are checked per frame for destroyed objects, after a garbage collection. 0 disables the sweep: stale entries are then only dropped when met on query.
+	UPROPERTY(EditAnywhere, Config, Category = "Pooling System", meta=(ClampMin = 0, UIMin = 0))
+	int32 PoolCleanUpBudgetPerTick = 64;
+
+	// Default time (milliseconds) an asynchronous pool pre-fill can spend creating objects each frame. <= 0 means no time limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Pooling System")
+	float PoolPreFillFrameBudgetMs = 2;
+
+	// Default number of objects an asynchronous pool pre-fill can create each frame. <= 0 means no count limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Pooling System")
+	int32 PoolPreFillMaxSpawnPerFrame = 0;
+
+	// Periodically grow or shrink the dormant reserve of each pooled class toward its observed live high-water mark.
+	UPROPERTY(EditAnywhere, Config, Category = "Pooling System")
+	bool bAdaptivePoolSizing = false;
+
+	// Seconds between two adaptive sizing passes.
+	UPROPERTY(EditAnywhere, Config, Category = "Pooling System", meta=(ClampMin = 0.1, UIMin = 0.1, EditCondition = "bAdaptivePoolSizing"))
+	float AdaptivePoolSizingInterval = 10;
+
+	// Objects kept per class (live + dormant), relative to the live high-water mark.
+	UPROPERTY(EditAnywhere, Config, Category = "Pooling System", meta=(ClampMin = 1, UIMin = 1, EditCondition = "bAdaptivePoolSizing"))
+	float AdaptivePoolHeadroom = 1.25f;
+
+	// On the server, make dormant replicated actors net dormant too, so they stop using relevancy and bandwidth.
+	// Clients keep their copy of the actor and only see it hidden and shown again on reuse.
+	UPROPERTY(EditAnywhere, Config, Category = "Pooling System")
+	bool bNetDormantPooledActors = true;
+
 #pragma endregion
 
 #pragma region Tweening
@@ -251,25 +289,72 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Tweening", meta=(ClampMin = 1, UIMin = 1))
 	int32 TweenCountToMultiThreadProcessing = 1000;
 
+	// Evaluate the costly eases from precomputed tables instead of analytically.
+	UPROPERTY(EditAnywhere, Config, Category = "Tweening")
+	bool bUseEaseLookupTables = false;
+
+	// Number of samples of the ease lookup tables and of the baked ease curves.
+	UPROPERTY(EditAnywhere, Config, Category = "Tweening", meta=(ClampMin = 16, UIMin = 16, ClampMax = 4096, UIMax = 4096))
+	int32 EaseLookupTableSamples = 256;
+
 #pragma endregion
 
 #pragma region Downmloading
 
+	// Downloads with chunks still to start. A download whose last chunks are in flight lets the next one start.
 	UPROPERTY(EditAnywhere, Config, Category = "Downloader")
 	int32 MaxConcurrentDownloads = 3;
 	
+	// The chunk size. The largest chunk size in adaptive mode.
 	UPROPERTY(EditAnywhere, Config, Category = "Downloader")
 	int32 DownloadChunkMBSize = 100;
+
+	// Cut chunks as the download goes, sized from the measured throughput and latency of the server.
+	UPROPERTY(EditAnywhere, Config, Category = "Downloader")
+	bool bAdaptiveChunkSize = false;
+
+	// The size of the first chunks, before any measure.
+	UPROPERTY(EditAnywhere, Config, Category = "Downloader", meta=(ClampMin = 1, UIMin = 1, EditCondition = "bAdaptiveChunkSize"))
+	int32 MinDownloadChunkMBSize = 1;
+
+	// The time a chunk should take to download over one connection.
+	UPROPERTY(EditAnywhere, Config, Category = "Downloader", meta=(ClampMin = 0.5, UIMin = 0.5, EditCondition = "bAdaptiveChunkSize"))
+	float TargetChunkSeconds = 10;
+
+	// The most bytes a failed chunk can cost to download again.
+	UPROPERTY(EditAnywhere, Config, Category = "Downloader", meta=(ClampMin = 1, UIMin = 1, EditCondition = "bAdaptiveChunkSize"))
+	int32 MaxChunkRetryMBCost = 32;
 	
 	UPROPERTY(EditAnywhere, Config, Category = "Downloader")
 	int32 DownloadChunkRetries = 3;
 	
+	// The connections a single download can use at once.
 	UPROPERTY(EditAnywhere, Config, Category = "Downloader")
 	int32 MaxConcurrentChunks = 3;
+
+	// The connections shared by the chunks of all the active downloads.
+	UPROPERTY(EditAnywhere, Config, Category = "Downloader", meta=(ClampMin = 1, UIMin = 1))
+	int32 MaxDownloadConnections = 8;
+
+	// Tune the connection count between Min and Max Download Connections from the measured throughput.
+	UPROPERTY(EditAnywhere, Config, Category = "Downloader")
+	bool bAdaptiveDownloadConnections = true;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Downloader", meta=(ClampMin = 1, UIMin = 1, EditCondition = "bAdaptiveDownloadConnections"))
+	int32 MinDownloadConnections = 2;
 	
 	UPROPERTY(EditAnywhere, Config, Category = "Downloader")
 	int32 FileInfosQueryTimeOutSeconds = 5;
 
+	// The size of the buffer each active chunk writes through to disk. Bounds the memory held per chunk, whatever the chunk size.
+	UPROPERTY(EditAnywhere, Config, Category = "Downloader", meta=(ClampMin = 4))
+	int32 DownloadWriteBufferKBSize = 1024;
+
+	// The hash computed on downloads as they are written. Downloads started with an expected hash fail on mismatch.
+	// Without one, downloads given an expected hash use the algorithm matching its length.
+	UPROPERTY(EditAnywhere, Config, Category = "Downloader")
+	EPulseDownloadHash DownloadHashType = EPulseDownloadHash::None;
+
 #pragma endregion
 
 #pragma region Save System
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PulseDownloadTypes.h"
+#include "GenericPlatform/GenericPlatformFile.h"
 #include "Interfaces/IHttpRequest.h"
 #include "UObject/Object.h"
 #include "PulseDownloadChunk.generated.h"
@@ -13,6 +15,43 @@ class UPulseDownloadChunk;
 DECLARE_MULTICAST_DELEGATE_OneParam(FDownloadChunkEventDelegate, UPulseDownloadChunk* Chunk);
 
 
+/**
+ * Write the bytes of a chunk response to the chunk file as they arrive, through a bounded buffer, hashing them on the way.
+ * Fed from the http thread, closed from the game thread. A resumed chunk (ExistingSize > 0) isn't hashed, it's hashed on merge.
+ */
+struct PULSEGAMEFRAMEWORK_API FPulseChunkFileWriter
+{
+public:
+	FPulseChunkFileWriter(const FString& Path, int64 ExistingSize, int64 MaxBytes, int32 BufferSize, EPulseDownloadHash HashType = EPulseDownloadHash::None);
+	~FPulseChunkFileWriter();
+
+	bool IsOpen() const;
+	// Buffer received bytes, flushing them to disk when the buffer is full. False if the bytes can't be written or exceed the expected size.
+	bool Receive(const uint8* Data, int64 Length);
+	// Flush the buffer and release the file.
+	void Close();
+	// Bytes that reached the disk.
+	int64 GetWrittenSize() const;
+	// The leaf digests of the whole chunk file, once closed. Empty if not hashed, resumed or if a write failed.
+	TArray<uint8> GetLeafDigests() const;
+
+private:
+	bool Flush_Internal();
+	bool Write_Internal(const uint8* Data, int64 Length);
+
+	mutable FCriticalSection _lock;
+	TUniquePtr<IFileHandle> _fileHandle;
+	TArray<uint8> _buffer;
+	int64 _remainingBytes = 0;
+	int64 _writtenBytes = 0;
+	int32 _bufferSize = 0;
+	bool _bFailed = false;
+	FPulseTreeHasher _hasher;
+	bool _bHashValid = false;
+	TArray<uint8> _leafDigests;
+};
+
+
 /**
  * Represent a part of an ongoing download.
  */
@@ -42,7 +81,39 @@ public:
 	UPROPERTY()
 	int64 LocalSize = 0;
 
+	// Size of the buffer the response is written through, in bytes.
+	UPROPERTY()
+	int32 WriteBufferSize = 1048576;
+
+	UPROPERTY()
+	EPulseDownloadHash HashType = EPulseDownloadHash::None;
+
+	// The tree hash leaves of the chunk, computed as it was written. Empty if unknown (completed in an earlier session).
+	UPROPERTY()
+	TArray<uint8> LeafDigests;
+
+	UPROPERTY()
+	FString ChunkHash;
+
+	// The requests of this chunk that failed before completing it. Cancelled requests (pause, cancel) don't count.
+	UPROPERTY()
+	int32 FailCount = 0;
+
+	// The ongoing request was cancelled on purpose, its end isn't a failure.
+	bool bCancelRequested = false;
+
+	// Bytes received since the last throughput sample.
+	int64 UnsampledBytes = 0;
+
+	// Timing of the request, as seen from the game thread.
+	double RequestStartTime = 0;
+	double FirstByteTime = 0;
+	int64 LastRequestBytes = 0;
+	double LastRequestSeconds = 0;
+	double LastRequestLatency = 0;
+
 	TSharedPtr<IHttpRequest> Request;
+	TSharedPtr<FPulseChunkFileWriter> Writer;
 
 	
 	bool IsValid() const;
@@ -56,6 +127,8 @@ public:
 	void InitializeChunk(const FString& LocalPath, int32 ChunkIdx, int64 From, int64 To);
 	bool StartChunk(const FString& Url);
 	bool CancelChunk();
+	// Flush and close the chunk file of the ongoing request.
+	void ReleaseChunkFile();
 	
 	void OnChunkUpdateCallback(FHttpRequestPtr Req, uint64 BytesSent, uint64 BytesReceived);
 	void OnChunkCompletedCallback(TSharedPtr<IHttpRequest> Req, TSharedPtr<IHttpResponse> Response, bool success);
@@ -67,5 +140,7 @@ public:
 		return ChunkPath == Other->ChunkPath && FileStartByte == Other->FileStartByte && FileEndByte == Other->FileEndByte;
 	}
 	
+	// Whether a response with this status code carries the bytes of a range starting at RangeStart.
+	static bool IsExpectedResponse(int32 StatusCode, int64 RangeStart);
 	static TSharedRef<IHttpRequest> MakeDownloadRequest(const FString& URL, FInt64Vector2 DownloadRange = FInt64Vector2(-1));
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <atomic>
 #include "PulseDownloadTypes.h"
 #include "DownloadManager/PulseDownloadChunk.h"
 #include "UObject/Object.h"
@@ -13,6 +14,37 @@ class UPulseDownloadTask;
 DECLARE_MULTICAST_DELEGATE_OneParam(FDownloadTaskEventDelegate, UPulseDownloadTask* Task);
 
 
+/**
+ * Progress and cancellation of a chunk merge, shared with the thread running it.
+ */
+struct FPulseChunkMergeState
+{
+	std::atomic<int64> MergedSize{0};
+	std::atomic<bool> bCancelled{false};
+	int64 TotalSize = 0;
+
+	EPulseDownloadHash HashType = EPulseDownloadHash::None;
+	// The leaf digests of each chunk, in order. Empty for the chunks to hash while merging.
+	TArray<TArray<uint8>> ChunkLeaves;
+	FString ExpectedHash;
+	FString FileHash;
+	bool bHashMismatch = false;
+
+	FString DigestChunkLeaves() const
+	{
+		TArray<uint8> leaves;
+		for (const auto& chunkLeaves : ChunkLeaves)
+			leaves.Append(chunkLeaves);
+		return FPulseTreeHasher::DigestLeaves(HashType, leaves);
+	}
+
+	bool MatchExpectedHash() const
+	{
+		return ExpectedHash.IsEmpty() || ExpectedHash.Equals(FileHash, ESearchCase::IgnoreCase);
+	}
+};
+
+
 /**
  * Represent an ongoing download task, with one or several download chunks 
  */
@@ -30,6 +62,8 @@ public:
 	FDownloadTaskEventDelegate OnTaskFailed;
 	FDownloadTaskEventDelegate OnTaskCancelled;
 	FDownloadTaskEventDelegate OnTaskPaused;
+	// A chunk of the task stopped and freed its connection, while the task goes on.
+	FDownloadTaskEventDelegate OnTaskSlotReleased;
 	
 	UPROPERTY(SkipSerialization)
 	int64 TotalSize = 0;
@@ -37,8 +71,13 @@ public:
 	UPROPERTY(SkipSerialization)
 	bool bDoServerSupportRange = false;
 
+	// The chunks of this task that can be downloaded at once.
 	UPROPERTY(SkipSerialization)
 	int32 ParallelChunkCount = 1;
+
+	// The times a chunk is requested again after failing, before the task fails.
+	UPROPERTY(SkipSerialization)
+	int32 MaxChunkRetries = 3;
 	
 	UPROPERTY(SkipSerialization)
 	EPulseDownloadState DownloadState = EPulseDownloadState::None;
@@ -52,15 +91,38 @@ public:
 	UPROPERTY(SkipSerialization)
 	bool bIsBound = false;
 
+	// Size of the buffer chunks are written and merged through, in bytes.
+	UPROPERTY(SkipSerialization)
+	int32 WriteBufferSize = 1048576;
+
 	UPROPERTY()
 	TArray<TObjectPtr<UPulseDownloadChunk>> Chunks;
 
+	// Set while the chunks are merged into the downloaded file.
+	TSharedPtr<FPulseChunkMergeState> MergeState;
+
+	// Size of the next chunks cut, in adaptive mode.
+	FPulseChunkSizer ChunkSizer;
+
 	bool IsInitialized() const;
 	bool IsComplete() const;
 	int64 GetTotalSize() const;
 	
-	int32 GenerateChunks(const int64 ChunkSize);
-	void StartChunksDownload(int32 MaxParallelChunks = 3, const float TimeOut = 5);
+	int32 GenerateChunks(const int64 ChunkSize, const int32 BufferSize = 1048576);
+	// Chunks are cut as the download goes, instead of all at once.
+	bool IsAdaptive() const;
+	FString GetChunkDirectory() const;
+	// The byte ranges of the file no chunk covers yet.
+	void GetUncoveredRanges(TArray<FInt64Vector2>& OutRanges) const;
+	// Cut a chunk of the measured size from the first uncovered range. Adaptive mode only.
+	UPulseDownloadChunk* CarveChunk();
+	// Chunks neither completed, downloading nor out of retries.
+	bool HasPendingChunks() const;
+	int32 GetActiveChunkCount() const;
+	// Start the first pending chunk that can be started.
+	bool StartNextChunk();
+	// The bytes received by the chunks since the last call.
+	int64 ConsumeReceivedBytes();
 	int64 GetDownloadedSize();
 	void GetDetailedDownloadedSize(TArray<int64>& OutChunkDownloadedSizes);
 	void GetDetailedTotalSizes(TArray<int64>& OutChunkTotalSizes);
@@ -71,10 +133,27 @@ public:
 	bool AddChunk(UPulseDownloadChunk* Chunk);
 	bool RemoveChunk(const int32 Index, bool DeleteFile = false);
 	void DeleteChunkFiles();
+	bool IsMerging() const;
+	// The ratio of the file already merged. 0 if no merge is ongoing.
+	float GetMergeProgress() const;
+	// Merge the chunks into the downloaded file on a background thread. The task completes or fails when done.
+	bool MergeChunks();
+	void CancelMerge();
+	void OnChunksMerged(const TSharedPtr<FPulseChunkMergeState>& State, bool bSuccess);
 
 	void OnChunkCompleted(UPulseDownloadChunk* Chunk);
 	void OnChunkUpdated(UPulseDownloadChunk* Chunk);	
 	void OnChunkFailed(UPulseDownloadChunk* Chunk);
+	// Broadcast the end of the task when none of its chunks is active anymore.
+	void EndTask_Internal();
+	UPulseDownloadChunk* MakeChunk_Internal(int32 ChunkIdx, int64 From, int64 To) const;
+	// Rebuild the chunks from their files, each one starting where its name says.
+	void GenerateAdaptiveChunks_Internal(TArray<FString>& ChunkPaths);
+	bool HasExhaustedChunk_Internal() const;
+
+	// Append the chunk files to the first one through a fixed size buffer, then move it to the file path. Thread safe.
+	static bool MergeChunkFiles(const TArray<FString>& ChunkPaths, const FString& FilePath, int32 BufferSize, FPulseChunkMergeState& State,
+	                            const TFunction<void()>& OnProgress);
 
 	bool operator==(const UPulseDownloadTask& Other) const
 	{
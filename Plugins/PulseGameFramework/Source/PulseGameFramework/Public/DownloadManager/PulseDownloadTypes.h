@@ -2,7 +2,10 @@
 
 #pragma once
 #include "CoreMinimal.h"
+#include "Core/PulseCoreTypes.h"
 #include "GameFramework/SaveGame.h"
+#include "Hash/xxhash.h"
+#include "Misc/SecureHash.h"
 #include "PulseDownloadTypes.generated.h"
 
 
@@ -20,6 +23,15 @@ enum class EPulseDownloadState : uint8
 };
 ENUM_CLASS_FLAGS(EPulseDownloadState);
 
+// The order in which downloads get connections
+UENUM(BlueprintType)
+enum class EPulseDownloadPriority : uint8
+{
+	Background = 0 UMETA(ToolTip = "Prefetch, downloaded when no other download needs the connections"),
+	Normal = 1,
+	Foreground = 2 UMETA(ToolTip = "Content the player waits for, served first"),
+};
+
 USTRUCT(BlueprintType)
 struct FDownloadIdentifier
 {
@@ -49,6 +61,25 @@ public:
 	UPROPERTY()
 	int64 SavedDownloadedSize = 0;
 
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "PulseCore|Download Manager")
+	EPulseDownloadPriority Priority = EPulseDownloadPriority::Normal;
+
+	// Chunks are cut as the download goes, and named after their start. Kept so a resumed download reads its chunks the same way.
+	UPROPERTY()
+	bool bAdaptiveChunks = false;
+
+	// The hash the download is verified with
+	UPROPERTY()
+	EPulseDownloadHash HashType = EPulseDownloadHash::None;
+
+	// The expected tree digest of the file (see FPulseTreeHasher). Not verified if empty.
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "PulseCore|Download Manager")
+	FString ExpectedHash;
+
+	// The tree digest of the downloaded file.
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "PulseCore|Download Manager")
+	FString FileHash;
+
 	bool IsValid() const
 	{
 		return Id.IsValid() && !Url.IsEmpty() && !Directory.IsEmpty();
@@ -92,4 +123,94 @@ public:
 };
 
 
+/**
+ * Hash a byte stream as fixed size leaves, the digest being the hash of all the leaf digests.
+ * Parts of a stream split on leaf boundaries can be hashed apart, in parallel, and their leaves joined in order.
+ */
+struct PULSEGAMEFRAMEWORK_API FPulseTreeHasher
+{
+public:
+	static constexpr int64 LeafSize = 1048576;
+
+	explicit FPulseTreeHasher(EPulseDownloadHash HashType = EPulseDownloadHash::None);
+
+	bool IsEnabled() const { return _type != EPulseDownloadHash::None; }
+	EPulseDownloadHash GetType() const { return _type; }
+	int64 GetHashedSize() const { return _hashedSize; }
+	void Update(const uint8* Data, int64 Length);
+	// Close the last partial leaf, and get every leaf digest in order.
+	const TArray<uint8>& Finish();
+
+	static int32 GetDigestSize(EPulseDownloadHash HashType);
+	// The digest of a list of leaf digests, as a lower case hex string.
+	static FString DigestLeaves(EPulseDownloadHash HashType, const TArray<uint8>& LeafDigests);
+	// The tree digest of a local file. Empty if the file can't be read.
+	static FString HashFile(const FString& FilePath, EPulseDownloadHash HashType, int32 BufferSize = 1048576);
+
+private:
+	void CloseLeaf_Internal();
+
+	EPulseDownloadHash _type = EPulseDownloadHash::None;
+	FMD5 _md5;
+	FXxHash64Builder _xxHash;
+	int64 _leafFill = 0;
+	int64 _hashedSize = 0;
+	TArray<uint8> _leafDigests;
+};
+
+
+/**
+ * Hill climbing on the download connection count. Connections are added while they raise the measured throughput, and removed when they don't.
+ */
+struct PULSEGAMEFRAMEWORK_API FPulseConnectionTuner
+{
+public:
+	void Initialize(int32 MinConnections, int32 MaxConnections, double WindowSeconds = 2);
+	int32 GetConnections() const { return _connections; }
+	// The throughput of the last measure window, in bytes per second. Negative before the first window.
+	double GetThroughput() const { return _lastThroughput; }
+	// Add received bytes. True when a measure window closed with a new connection count.
+	bool AddSample(int64 Bytes, double Now);
+
+private:
+	int32 _minConnections = 1;
+	int32 _maxConnections = 1;
+	int32 _connections = 1;
+	int32 _direction = 1;
+	double _windowSeconds = 2;
+	double _windowStart = -1;
+	double _lastThroughput = -1;
+	int64 _windowBytes = 0;
+};
+
+
+/**
+ * Size download chunks from the measured throughput and latency of one connection.
+ * A chunk lasts about the target duration, and never costs more than the max retry cost to download again.
+ */
+struct PULSEGAMEFRAMEWORK_API FPulseChunkSizer
+{
+public:
+	void Initialize(int64 MinChunkSize, int64 MaxChunkSize, double TargetSeconds, int64 MaxRetryCost, int64 Alignment = FPulseTreeHasher::LeafSize);
+	// Add a completed chunk request: its size, its duration, and its time to first byte.
+	void AddSample(int64 Bytes, double Seconds, double LatencySeconds);
+	// The size of the next chunk, a multiple of the alignment.
+	int64 GetChunkSize() const;
+	// Smoothed transfer rate of one connection in bytes per second. 0 before any sample.
+	double GetThroughput() const { return _throughput; }
+	double GetLatency() const { return _latency; }
+	int64 GetAlignment() const { return _alignment; }
+
+private:
+	int64 _minChunkSize = 1048576;
+	int64 _maxChunkSize = 1048576;
+	int64 _maxRetryCost = 1048576;
+	int64 _alignment = 1048576;
+	double _targetSeconds = 10;
+	double _throughput = 0;
+	double _latency = 0;
+	int32 _sampleCount = 0;
+};
+
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPulseDownloadDelegateEvent, const FGuid&, DownloadId);
@@ -29,6 +29,16 @@ protected:
 	int32 _downloadChunkMBSize = 100;
 	int32 _downloadChunkRetries = 3;
 	int32 _fileInfosQueryTimeOutSeconds = 5;
+	int32 _downloadWriteBufferKBSize = 1024;
+	EPulseDownloadHash _downloadHashType = EPulseDownloadHash::None;
+	int32 _maxDownloadConnections = 8;
+	int32 _minDownloadConnections = 2;
+	bool _bAdaptiveDownloadConnections = true;
+	FPulseConnectionTuner _connectionTuner;
+	bool _bAdaptiveChunkSize = false;
+	int32 _minDownloadChunkMBSize = 1;
+	float _targetChunkSeconds = 10;
+	int32 _maxChunkRetryMBCost = 32;
 
 	// Make a download Task from an identifier
 	bool StartDownload_Internal(const FDownloadIdentifier& DownloadIdentifier);
@@ -41,6 +51,12 @@ protected:
 	
 	static void DownloadTask(const FGuid& DownloadId, int32 MBChunkSize);
 
+	// Hand the free connections to the pending chunks of all the active downloads, by priority.
+	void ScheduleChunks();
+
+	// The downloads holding a download slot: downloading, with chunks still to start.
+	int32 GetActiveDownloadCount() const;
+
 	void BroadcastDownloadEvent(const FGuid& DownloadId, EPulseDownloadState EventType);
 
 	static void OnReceiveDownloadInfos(const FGuid& DownloadId, FString FileName, bool Succeeded, int64 FileSize);
@@ -61,6 +77,8 @@ protected:
 	
 	void OnPausedDownloadTask(UPulseDownloadTask* DownloadTask);
 	
+	void OnSlotReleasedDownloadTask(UPulseDownloadTask* DownloadTask);
+	
 	void SaveRememberFile();
 	
 	void LoadRememberFile();
@@ -106,10 +124,21 @@ public:
 	 * @param OutDownloadId The Output Download ID
 	 * @param DownloadDirectory The sub-folder in the download folder where to save the file (must exist and be writable) [Optional] 
 	 * @param bImmediateStart Start the download as soon as it get ready to be downloaded.
+	 * @param ExpectedHash The expected digest of the file, as given by ComputeDownloadHash. The download fails on mismatch. [Optional]
+	 * @param Priority The order in which the download gets connections.
 	 * @return True if the download was successfully put in the download Queue.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Pulse Download", meta=(AdvancedDisplay = 1))
-	bool StartDownload(const FString& Url, FGuid& OutDownloadId, const FString& DownloadDirectory = "", bool bImmediateStart = true);
+	bool StartDownload(const FString& Url, FGuid& OutDownloadId, const FString& DownloadDirectory = "", bool bImmediateStart = true, const FString& ExpectedHash = "",
+	                   EPulseDownloadPriority Priority = EPulseDownloadPriority::Normal);
+
+	// Change the priority of a download by ID. Takes effect as connections free up.
+	UFUNCTION(BlueprintCallable, Category="Pulse Download")
+	bool SetDownloadPriority(const FGuid& DownloadId, EPulseDownloadPriority Priority);
+
+	// Get the number of connections shared by the active downloads, as currently tuned.
+	UFUNCTION(BlueprintPure, Category="Pulse Download")
+	int32 GetDownloadConnectionCount() const;
 
 	// Pause an active download by ID
 	UFUNCTION(BlueprintCallable, Category="Pulse Download")
@@ -155,6 +184,10 @@ public:
 	UFUNCTION(BlueprintPure, Category="Pulse Download")
 	bool GetDownloadProgress(const FGuid& DownloadId, float& OutProgress) const;
 	
+	// Get the percentage of the chunks merged into the downloaded file, once all chunks are downloaded.
+	UFUNCTION(BlueprintPure, Category="Pulse Download")
+	bool GetDownloadMergeProgress(const FGuid& DownloadId, float& OutProgress) const;
+	
 	// Get the per-chunk percentage of the download by ID
 	UFUNCTION(BlueprintPure, Category="Pulse Download")
 	bool GetDetailedDownloadProgress(const FGuid& DownloadId, TArray<float>& OutProgresses) const;
@@ -183,4 +216,8 @@ public:
 
 	UFUNCTION(BlueprintPure, Category="Pulse Download")
 	static FString ToString(const FDownloadIdentifier& Identifier);
+
+	// Compute the digest a download of this local file would have. Used to produce the expected hash of published files. Empty if the file can't be read.
+	UFUNCTION(BlueprintCallable, Category="Pulse Download")
+	static FString ComputeDownloadHash(const FString& FilePath, EPulseDownloadHash HashType = EPulseDownloadHash::MD5);
 };
@@ -0,0 +1,67 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "AsyncPreFillPool.generated.h"
+
+
+class UPulseObjectPooling;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAsyncPreFillPoolEvent, int32, FilledCount, int32, TotalCount);
+
+
+// Async task to pre-fill the object pool over several frames
+UCLASS()
+class PULSEGAMEFRAMEWORK_API UAsyncPreFillPool : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	// Blueprint node exposed function. FrameBudgetMs and MaxSpawnPerFrame values < 0 use the project settings, 0 means no limit.
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = 3), Category = "PulseCore|Pooling")
+	static UAsyncPreFillPool* WaitPreFillPool(UObject* WorldContextObject, TArray<TSubclassOf<UObject>> ObjectClasses, int32 CountPerObject = 5, float FrameBudgetMs = -1,
+	                                          int32 MaxSpawnPerFrame = -1);
+
+	// Called each frame objects were created
+	UPROPERTY(BlueprintAssignable)
+	FOnAsyncPreFillPoolEvent OnProgress;
+
+	// Called when all objects were created
+	UPROPERTY(BlueprintAssignable)
+	FOnAsyncPreFillPoolEvent OnCompleted;
+
+	// Called when the pre-fill was cancelled
+	UPROPERTY(BlueprintAssignable)
+	FOnAsyncPreFillPoolEvent OnCancelled;
+
+	// Stop the pre-fill. Objects already created stay in the pool.
+	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling")
+	void Cancel();
+
+protected:
+	virtual void Activate() override;
+
+	UFUNCTION()
+	void OnPreFillProgress_Internal(const FGuid& JobID, int32 FilledCount, int32 TotalCount);
+
+	UFUNCTION()
+	void OnPreFillCompleted_Internal(const FGuid& JobID, bool bCancelled);
+
+	void Finish_Internal();
+
+private:
+	UPROPERTY()
+	TObjectPtr<UObject> _worldContext;
+	UPROPERTY()
+	TWeakObjectPtr<UPulseObjectPooling> _pooling;
+	UPROPERTY()
+	TArray<TSubclassOf<UObject>> _classes;
+	int32 _countPerObject = 5;
+	float _frameBudgetMs = -1;
+	int32 _maxSpawnPerFrame = -1;
+	FGuid _jobID;
+	int32 _filledCount = 0;
+	int32 _totalCount = 0;
+};
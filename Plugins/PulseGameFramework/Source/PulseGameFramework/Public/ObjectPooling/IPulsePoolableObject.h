@@ -25,8 +25,15 @@ class PULSEGAMEFRAMEWORK_API IIPulsePoolableObject
 public:
 
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Pooling System")
-	bool OnPoolQuery(const FPoolingParams SpawnData);
-	virtual bool OnPoolQuery_Implementation(const FPoolingParams SpawnData);
+	bool OnPoolQuery(FPoolingParams SpawnData);
+	virtual bool OnPoolQuery_Implementation(FPoolingParams SpawnData);
+
+	// Native entry point of a pool query. Override it to read the spawn data without building nor copying an FPoolingParams.
+	// The default implementation forwards to OnPoolQuery.
+	virtual bool OnPoolQueryNative(const FPoolingParamsView& SpawnData);
+
+	// Send the spawn data to the object: through OnPoolQueryNative for native implementations, OnPoolQuery otherwise.
+	static bool DispatchPoolQuery(UObject* Object, const FPoolingParamsView& SpawnData);
 
 
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Pooling System")
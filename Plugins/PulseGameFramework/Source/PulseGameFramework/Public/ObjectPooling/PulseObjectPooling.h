@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Core/PulseCoreTypes.h"
 #include "ObjectPooling/PulsePoolingTypes.h"
+#include "Subsystems/WorldSubsystem.h"
 #include "PulseObjectPooling.generated.h"
 
 
@@ -13,7 +14,7 @@
  * The Pulse Pooling System
  */
 UCLASS(BlueprintType)
-class PULSEGAMEFRAMEWORK_API UPulseObjectPooling : public UWorldSubsystem, public IIPulseCore
+class PULSEGAMEFRAMEWORK_API UPulseObjectPooling : public UTickableWorldSubsystem, public IIPulseCore
 {
 	GENERATED_BODY()
 	
@@ -26,10 +27,32 @@ private:
 	TMap<TSubclassOf<UObject>, int32> PerClassPoolLimit;
 	UPROPERTY()
 	TMap<TWeakObjectPtr<AActor>, FPoolingTypeObjects> _linkedPoolObjectActors;
+	// Reverse index of _linkedPoolObjectActors: pooled object -> actor that requested it.
+	TMap<FObjectKey, TWeakObjectPtr<AActor>> _pooledObjectOwners;
+	// Dormancy state of pooled actors.
+	TMap<FObjectKey, FPooledActorDormancy> _actorDormancy;
+	bool _bNetDormantPooledActors = true;
 	int32 _globalPoolLimit = 100;
+	int32 _cleanUpBudgetPerTick = 64;
+	float _preFillFrameBudgetMs = 2;
+	int32 _preFillMaxSpawnPerFrame = 0;
+	UPROPERTY()
+	TArray<FPoolPreFillJob> _preFillJobs;
+	UPROPERTY()
+	TMap<TSubclassOf<UObject>, FPoolClassStats> _poolStats;
+	bool _bAdaptivePoolSizing = false;
+	float _adaptiveSizingInterval = 10;
+	float _adaptiveHeadroom = 1.25f;
+	float _adaptiveSizingTimer = 0;
+	TMap<TSubclassOf<UObject>, FGuid> _adaptivePreFillJobs;
 	FName _poolRepTag = "PulseCore.Pooling";
-	FDelegateHandle _DeleteDelegate;
+	FDelegateHandle _PostGCDelegate;
 	FDelegateHandle _DuplicateDelegate;
+
+	// Incremental clean up state. Classes are swept live pool first, then dormant pool.
+	TArray<TSubclassOf<UObject>> _sweepClasses;
+	int32 _sweepClassIndex = 0;
+	bool _bSweepingDormant = false;
 	
 public:
 
@@ -48,10 +71,30 @@ public:
 	// Called when a type of object is no longer among actives or inactives.  
 	UPROPERTY(BlueprintAssignable, Category="Pooling")
 	FPulsePoolingEvent OnPoolCleared;
+	
+	// Called once per batch query, with the number of objects pooled out and created
+	UPROPERTY(BlueprintAssignable, Category="Pooling")
+	FPulsePoolingBatchQueryEvent OnPoolBatchQuery;
+	
+	// Called once per class in a batch dispose, with the number of objects disposed
+	UPROPERTY(BlueprintAssignable, Category="Pooling")
+	FPulsePoolingBatchEvent OnPoolBatchDisposed;
+	
+	// Called each frame an asynchronous pre-fill created objects
+	UPROPERTY(BlueprintAssignable, Category="Pooling")
+	FPulsePoolPreFillEvent OnPoolPreFillProgress;
+	
+	// Called when an asynchronous pre-fill is done or cancelled
+	UPROPERTY(BlueprintAssignable, Category="Pooling")
+	FPulsePoolPreFillCompletedEvent OnPoolPreFillCompleted;
 
 	
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual void Tick(float DeltaTime) override;
 
 
 protected:
@@ -70,15 +113,45 @@ protected:
 	// Function to remove an now invalid objects from the pools
 	void CleanUpPools(TObjectPtr<UClass> Class);
 
+	// Remove invalid objects from the pools, checking at most Budget entries. Resume where the last call stopped.
+	void SweepPools_Internal(int32 Budget);
+
 	UFUNCTION()
 	void OnDestroyLinkedActor_Internal(AActor* Actor);
+
+	// Remove the object from the linked actor that requested it, if any.
+	void UnlinkObjectFromOwner_Internal(UObject* Object);
 	
 	void OnObjectsReplaced_Internal(const TMap<UObject*, UObject*>& ReplacementMap);
 	
-	void OnGCPreDestroy_Internal();
+	void OnPostGarbageCollect_Internal();
 	
 	EPoolQueryResult DisposeObject_Internal(UObject* Object);
 
+	// Get up to Count objects of the class at once. GetParams gives the query params of the object at an output index.
+	EPoolQueryResult QueryObjects_Internal(UObject* Owner, TSubclassOf<UObject> Class, int32 Count, TArray<UObject*>& Outputs, TFunctionRef<FPoolingParamsView(int32)> GetParams);
+
+	// Dispose objects all of the same class. Returns the number of objects disposed.
+	int32 DisposeObjectRun_Internal(UClass* Class, TArrayView<UObject* const> Objects);
+
+	// Destroy up to Count dormant objects of the class. Returns the number of objects destroyed.
+	int32 EvictDormantObjects_Internal(TSubclassOf<UObject> Class, int32 Count);
+
+	// Grow or shrink dormant reserves toward the observed live high-water mark of each class.
+	void AdaptPoolSizes_Internal();
+
+	// Put a pooled actor to sleep or wake it up.
+	void SetPooledActorDormant_Internal(AActor* Actor, bool bDormant);
+
+	// Get the number of dormant objects that can still be added for the class before reaching its limit.
+	int32 GetPreFillRoom_Internal(TSubclassOf<UObject> Class) const;
+
+	// Create a new object of the class and put it directly in the dormant pool.
+	void PreFillOne_Internal(TSubclassOf<UObject> Class);
+
+	// Advance asynchronous pre-fill jobs within their frame budget.
+	void ProcessPreFillJobs_Internal();
+
 public:
 
 	static UPulseObjectPooling* Get(const UObject* WorldContext);
@@ -86,8 +159,22 @@ public:
 	// Function to get an object from the pool. If the object is not found, it will create a new one and return it.
 	// be aware that for actor component pooling, the world context will be use as the owner of the component
 	// , so make sure to call this function from an actor or manually set the world context to the actor.
-	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling", meta = (AdvancedDisplay = 3, DeterminesOutputType="Class", DynamicOutputParam="Output"))
-	EPoolQueryResult QueryObject(UObject* Owner, TSubclassOf<UObject> Class, UObject*& Output, FPoolingParams QueryParams);
+	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling", meta = (AdvancedDisplay = 3, AutoCreateRefTerm = "QueryParams", DeterminesOutputType="Class", DynamicOutputParam="Output"))
+	EPoolQueryResult QueryObject(UObject* Owner, TSubclassOf<UObject> Class, UObject*& Output, const FPoolingParams& QueryParams);
+
+	// Native query with the spawn transform as only param. Does not allocate when the object overrides OnPoolQueryNative.
+	EPoolQueryResult QueryObject(UObject* Owner, TSubclassOf<UObject> Class, UObject*& Output, const FTransform& SpawnTransform);
+
+	// Native query with params viewed from the caller's own storage.
+	EPoolQueryResult QueryObject(UObject* Owner, TSubclassOf<UObject> Class, UObject*& Output, const FPoolingParamsView& QueryParams);
+
+	// Function to get several objects of a class from the pool at once. Missing objects are created within the pool limit.
+	// Outputs receives the objects obtained, and the result is Success only if all Count objects were.
+	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling", meta = (AdvancedDisplay = 4, AutoCreateRefTerm = "QueryParams", DeterminesOutputType="Class", DynamicOutputParam="Outputs"))
+	EPoolQueryResult QueryObjects(UObject* Owner, TSubclassOf<UObject> Class, int32 Count, TArray<UObject*>& Outputs, const FPoolingParams& QueryParams);
+
+	// Native batch query, one object per spawn transform.
+	EPoolQueryResult QueryObjects(UObject* Owner, TSubclassOf<UObject> Class, TArrayView<const FTransform> SpawnTransforms, TArray<UObject*>& Outputs);
 
 	// Register an existing object in the pool (live pool)
 	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling")
@@ -97,10 +184,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling")
 	void PreFillPool(TArray<TSubclassOf<UClass>> ObjectClasses, int32 CountPerObject = 5);
 
+	// Preload objects of the specified classes into the pool, spread over several frames. Returns the pre-fill job ID (invalid if there is nothing to preload).
+	// FrameBudgetMs and MaxSpawnPerFrame limits the work done each frame. Values < 0 use the project settings, 0 means no limit. At least one object is created per frame.
+	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling", meta = (AdvancedDisplay = 2))
+	FGuid PreFillPoolAsync(TArray<TSubclassOf<UObject>> ObjectClasses, int32 CountPerObject = 5, float FrameBudgetMs = -1, int32 MaxSpawnPerFrame = -1);
+
+	// Stop an asynchronous pre-fill. Objects already created stay in the pool.
+	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling")
+	bool CancelPreFillPool(const FGuid& JobID);
+
+	// Check if an asynchronous pre-fill is still running
+	UFUNCTION(BlueprintPure, Category = "PulseCore|Pooling")
+	bool IsPreFillingPool(const FGuid& JobID) const;
+
 	// Function to return an object to the pool
 	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling")
 	EPoolQueryResult DisposeObject(UObject* Object);
 
+	// Function to return several objects to the pool at once. Returns the number of objects disposed.
+	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling")
+	int32 DisposeObjects(const TArray<UObject*>& Objects);
+
+	int32 DisposeObjects(TArrayView<UObject* const> Objects);
+
 
 	// Function to clear the pool form the specified class
 	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling")
@@ -124,6 +230,22 @@ public:
 	UFUNCTION(BlueprintPure, Category = "PulseCore|Pooling", meta = (AdvancedDisplay = 2))
 	void GetPoolClasses(TMap<TSubclassOf<UObject>, int32>& OutClasses);
 
+	// Check if an actor is a pooled actor currently sleeping in the dormant pool
+	UFUNCTION(BlueprintPure, Category = "PulseCore|Pooling")
+	bool IsPooledActorDormant(const AActor* Actor) const;
+
+	// Get the usage statistics of a pooled class
+	UFUNCTION(BlueprintPure, Category = "PulseCore|Pooling")
+	bool GetPoolClassStats(TSubclassOf<UObject> Class, FPoolClassStats& OutStats) const;
+
+	// Reset the usage statistics of all pooled classes
+	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling")
+	void ResetPoolStats();
+
+	// Enable or disable the adaptive sizing of the dormant reserves.
+	UFUNCTION(BlueprintCallable, Category = "PulseCore|Pooling")
+	void SetAdaptivePoolSizing(bool bEnable);
+
 	// Get class count in pool
 	UFUNCTION(BlueprintPure, Category = "PulseCore|Pooling", meta = (AdvancedDisplay = 2))
 	void GetPoolClassCount(TSubclassOf<UObject> Class, int32& OutActiveCount, int32& OutInactiveCount);
@@ -3,9 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/EngineTypes.h"
 #include "PulsePoolingTypes.generated.h"
 
 
+class AActor;
+class UPrimitiveComponent;
+
+
 UENUM(BlueprintType)
 enum class EPoolQueryResult : uint8
 {
@@ -53,6 +59,46 @@ public:
 };
 
 
+// Non-owning view over pooling query params. Native callers can build one from a single transform (or their own
+// arrays) without allocating. The viewed data must outlive the query.
+struct PULSEGAMEFRAMEWORK_API FPoolingParamsView
+{
+	TArrayView<const FTransform> TransformParams;
+	TArrayView<const FVector> VectorParams;
+	TArrayView<const FLinearColor> ColorParams;
+	TArrayView<const FRotator> RotationParams;
+	TArrayView<const float> ValueParams;
+	TArrayView<const FPrimaryAssetId> AssetParams;
+	TArrayView<const FName> NamesParams;
+	TArrayView<const TObjectPtr<UObject>> CustomParams;
+
+	// The params this view was made from, if any. Lets Blueprint events receive them without a copy.
+	const FPoolingParams* Source = nullptr;
+
+	FPoolingParamsView() = default;
+	FPoolingParamsView(const FPoolingParams& Params);
+	explicit FPoolingParamsView(const FTransform& SpawnTransform);
+
+	bool IsValid() const;
+
+	// Typed accessors. Return nullptr when there is no param at this index.
+	const FTransform* GetTransform(int32 Index = 0) const { return TransformParams.IsValidIndex(Index) ? &TransformParams[Index] : nullptr; }
+	const FVector* GetVector(int32 Index = 0) const { return VectorParams.IsValidIndex(Index) ? &VectorParams[Index] : nullptr; }
+	const FLinearColor* GetColor(int32 Index = 0) const { return ColorParams.IsValidIndex(Index) ? &ColorParams[Index] : nullptr; }
+	const FRotator* GetRotation(int32 Index = 0) const { return RotationParams.IsValidIndex(Index) ? &RotationParams[Index] : nullptr; }
+	const float* GetValue(int32 Index = 0) const { return ValueParams.IsValidIndex(Index) ? &ValueParams[Index] : nullptr; }
+	const FPrimaryAssetId* GetAsset(int32 Index = 0) const { return AssetParams.IsValidIndex(Index) ? &AssetParams[Index] : nullptr; }
+	const FName* GetName(int32 Index = 0) const { return NamesParams.IsValidIndex(Index) ? &NamesParams[Index] : nullptr; }
+	UObject* GetCustom(int32 Index = 0) const { return CustomParams.IsValidIndex(Index) ? CustomParams[Index].Get() : nullptr; }
+
+	// Copy the viewed params into an FPoolingParams.
+	void ToParams(FPoolingParams& OutParams) const;
+};
+
+
+// Per-class pool storage. Objects live in a dense array, and each object remembers its slot index
+// so that add, remove and lookup are O(1). Removal swaps the last element into the freed slot.
+// Entries of objects destroyed or collected while pooled are removed lazily (see TrimInvalidLast and CleanStep).
 USTRUCT(NotBlueprintType)
 struct PULSEGAMEFRAMEWORK_API FPoolingTypeObjects
 {
@@ -63,18 +109,31 @@ private:
 	UPROPERTY()
 	TArray<TObjectPtr<UObject>> ObjectSet;
 
+	// Keys of ObjectSet, slot for slot. Still valid once the GC nulled the object pointer.
+	TArray<FObjectKey> ObjectKeys;
+
+	// Object -> index in ObjectSet.
+	TMap<FObjectKey, int32> SlotIndexes;
+
+	// Next slot the incremental clean step will check.
+	int32 SweepCursor = 0;
+
+	void RemoveAtSlot(int32 Index);
+
 public:
 	
 	FPoolingTypeObjects() { ObjectSet = {}; }
 
 	FPoolingTypeObjects(TArray<UObject*> array)
 	{
-		ObjectSet.Empty();
+		ObjectSet.Reserve(array.Num());
+		ObjectKeys.Reserve(array.Num());
+		SlotIndexes.Reserve(array.Num());
 		for (UObject* obj : array)
-			ObjectSet.AddUnique(obj);
+			Add(obj);
 	}
 
-	bool IsValid() const { return !ObjectSet.IsEmpty() && ObjectSet[0]; }
+	bool IsValid() const { return !ObjectSet.IsEmpty(); }
 
 	int32 Count() const { return ObjectSet.Num(); }
 
@@ -85,61 +144,30 @@ public:
 		return ObjectSet[0].Get();
 	}
 
-	bool Contains(UObject* obj) const { return ObjectSet.Contains(obj); }
-
-	bool Add(UObject* obj)
+	// Get the most recently added object, the cheapest one to take out of the pool.
+	UObject* GetLast() const
 	{
-		ObjectSet.AddUnique(obj);
-		return true;
+		if (ObjectSet.IsEmpty())
+			return nullptr;
+		return ObjectSet.Last().Get();
 	}
 
-	bool Remove(UObject* obj)
-	{
-		const int32 remCount = ObjectSet.Remove(obj);
-		return remCount > 0;
-	}
+	bool Contains(UObject* obj) const { return obj && SlotIndexes.Contains(FObjectKey(obj)); }
 
-	bool Replace(UObject* Old, UObject* New, bool bAddIfNotExist = true)
-	{
-		if (!ObjectSet.Contains(Old))
-		{
-			if (!bAddIfNotExist)
-				return false;
-			if (!New)
-				return false;
-			ObjectSet.Add(New);
-			return true;
-		}
-		ObjectSet.Remove(Old);
-		if (New)
-			ObjectSet.AddUnique(New);
-		return true;
-	}
+	bool Add(UObject* obj);
 
-	void Clean(bool bDestroy = false)
-	{
-		const auto array = ObjectSet;
-		for (auto obj : array)
-		{
-			if (obj)
-			{
-				if (bDestroy)
-				{
-					if (auto asActor = Cast<AActor>(obj))
-						asActor->Destroy();
-					else if (auto asComponent = Cast<UActorComponent>(obj))
-						asComponent->ConditionalBeginDestroy();
-					else
-						obj->MarkAsGarbage();
-					ObjectSet.Remove(obj);
-				}
-				continue;
-			}
-			ObjectSet.Remove(obj);
-		}
-		if (bDestroy)
-			ObjectSet.Empty();
-	}
+	bool Remove(UObject* obj);
+
+	bool Replace(UObject* Old, UObject* New, bool bAddIfNotExist = true);
+
+	// Drop destroyed or collected objects from the end of the set, until the last object is usable. Returns it.
+	UObject* TrimInvalidLast();
+
+	// Check up to Budget slots for destroyed or collected objects, resuming where the previous step stopped.
+	// Budget is decreased by the number of slots checked. Returns true once the end of the set is reached.
+	bool CleanStep(int32& Budget);
+
+	void Clean(bool bDestroy = false);
 
 	void ForAllValid(TFunction<void(UObject*)> Action)
 	{
@@ -157,4 +185,136 @@ public:
 
 
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPulsePoolingEvent, TSubclassOf<UObject>, Type);
\ No newline at end of file
+// Usage statistics of a pooled class
+USTRUCT(BlueprintType)
+struct PULSEGAMEFRAMEWORK_API FPoolClassStats
+{
+	GENERATED_BODY()
+
+public:
+	// Objects handed out from the dormant pool
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pooling System")
+	int32 Hits = 0;
+
+	// Objects handed out that had to be created
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pooling System")
+	int32 Misses = 0;
+
+	// Objects not handed out because the pool limit was reached
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pooling System")
+	int32 LimitRefusals = 0;
+
+	// Objects created by the pool, from queries and pre-fills
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pooling System")
+	int32 Creations = 0;
+
+	// Objects destroyed instead of going (or staying) dormant
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pooling System")
+	int32 Evictions = 0;
+
+	// Highest number of live objects at the same time
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pooling System")
+	int32 PeakLive = 0;
+
+	// Highest number of dormant objects at the same time
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pooling System")
+	int32 PeakDormant = 0;
+
+	// Average duration of a successful query, in microseconds
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pooling System")
+	float AverageAcquireMicroseconds = 0;
+
+	// Highest number of live objects since the last adaptive sizing pass
+	int32 WindowPeakLive = 0;
+
+	// Highest number of live objects during the previous adaptive sizing window
+	int32 PreviousWindowPeakLive = 0;
+
+	double TotalAcquireSeconds = 0;
+
+	int32 AcquireCount = 0;
+
+	// Record Count acquisitions that took Seconds in total.
+	void RecordAcquire(double Seconds, int32 Count = 1)
+	{
+		TotalAcquireSeconds += Seconds;
+		AcquireCount += Count;
+		AverageAcquireMicroseconds = static_cast<float>(TotalAcquireSeconds * 1e6 / AcquireCount);
+	}
+
+	void RecordLiveCount(int32 Count)
+	{
+		PeakLive = FMath::Max(PeakLive, Count);
+		WindowPeakLive = FMath::Max(WindowPeakLive, Count);
+	}
+
+	void RecordDormantCount(int32 Count) { PeakDormant = FMath::Max(PeakDormant, Count); }
+};
+
+
+// Cached dormancy state of a pooled actor. Built once per actor, so putting it to sleep or waking it up
+// doesn't walk all its components nor use actor tags.
+struct PULSEGAMEFRAMEWORK_API FPooledActorDormancy
+{
+	bool bDormant = false;
+
+	// Number of components the actor had when the cache was built. A different count means the cache is outdated.
+	int32 ComponentCount = -1;
+
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Primitives;
+
+	// Primitives that were simulating physics when the actor went dormant, to restore on wake up.
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> SuspendedSimulations;
+
+	// The actor was made net dormant when it went to sleep, and must be woken on the network too.
+	bool bNetDormant = false;
+
+	// The net dormancy the actor had before the pool made it dormant, restored on wake up. An initial dormancy comes back as DormantAll.
+	TEnumAsByte<ENetDormancy> RestoreNetDormancy = DORM_Awake;
+
+	// Rebuild the list of components to toggle.
+	void Refresh(const AActor* Actor);
+
+	// Put the actor to sleep or wake it up. Returns false if it was already in that state.
+	// With bManageNetDormancy, a replicated actor on the server also goes net dormant once its hidden state is sent.
+	bool SetDormant(AActor* Actor, bool bNewDormant, bool bManageNetDormancy = false);
+};
+
+
+// A pool pre-fill spread over several frames.
+USTRUCT(NotBlueprintType)
+struct PULSEGAMEFRAMEWORK_API FPoolPreFillJob
+{
+	GENERATED_BODY()
+
+public:
+	FGuid JobID;
+
+	UPROPERTY()
+	TArray<TSubclassOf<UObject>> Classes;
+
+	// Objects left to create, per entry of Classes.
+	TArray<int32> RemainingCounts;
+
+	int32 ClassIndex = 0;
+
+	int32 FilledCount = 0;
+
+	int32 TotalCount = 0;
+
+	// Time allowed per frame, in milliseconds. <= 0 means no time limit.
+	float FrameBudgetMs = 0;
+
+	// Objects allowed to be created per frame. <= 0 means no count limit.
+	int32 MaxSpawnPerFrame = 0;
+
+	bool IsDone() const { return !RemainingCounts.IsValidIndex(ClassIndex); }
+};
+
+
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPulsePoolingEvent, TSubclassOf<UObject>, Type);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FPulsePoolingBatchQueryEvent, TSubclassOf<UObject>, Type, int32, ReusedCount, int32, CreatedCount);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FPulsePoolingBatchEvent, TSubclassOf<UObject>, Type, int32, Count);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FPulsePoolPreFillEvent, const FGuid&, JobID, int32, FilledCount, int32, TotalCount);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FPulsePoolPreFillCompletedEvent, const FGuid&, JobID, bool, bCancelled);
\ No newline at end of file
@@ -0,0 +1,181 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/TypeCompatibleBytes.h"
+
+
+// Handle to an element of a TPulseStructPool. Handles of released elements, or from before a pool reset, resolve to nullptr.
+struct FPulseStructPoolHandle
+{
+	uint32 Index = MAX_uint32;
+	uint32 Generation = 0;
+	uint32 Epoch = 0;
+
+	bool IsSet() const { return Index != MAX_uint32; }
+
+	bool operator==(const FPulseStructPoolHandle& Other) const { return Index == Other.Index && Generation == Other.Generation && Epoch == Other.Epoch; }
+	bool operator!=(const FPulseStructPoolHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FPulseStructPoolHandle& Handle) { return HashCombine(HashCombine(Handle.Index, Handle.Generation), Handle.Epoch); }
+};
+
+
+/**
+ * Typed pool for plain C++ structs (hit records, damage events...), to avoid a heap allocation per element.
+ * Elements live in fixed size chunks, so their address never changes while they are alive.
+ * Acquire and Release are O(1). Reset releases every element at once and invalidates all handles; for trivially
+ * destructible types it only clears the alive flags, making it suited to per-frame transient data.
+ * Not thread safe.
+ */
+template <typename T, uint32 ChunkSize = 256>
+class TPulseStructPool
+{
+	static_assert(ChunkSize > 0, "TPulseStructPool chunk size must be greater than 0");
+
+public:
+	TPulseStructPool() = default;
+	TPulseStructPool(const TPulseStructPool&) = delete;
+	TPulseStructPool& operator=(const TPulseStructPool&) = delete;
+
+	~TPulseStructPool()
+	{
+		DestroyAlive();
+	}
+
+	// Construct a new element in the pool and return its handle.
+	template <typename... ArgsType>
+	FPulseStructPoolHandle Acquire(ArgsType&&... Args)
+	{
+		uint32 index;
+		if (!FreeSlots.IsEmpty())
+		{
+			index = FreeSlots.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			index = UsedSlots++;
+			if (index >= static_cast<uint32>(Generations.Num()))
+			{
+				if (index / ChunkSize >= static_cast<uint32>(Chunks.Num()))
+					Chunks.Add(MakeUnique<TTypeCompatibleBytes<T>[]>(ChunkSize));
+				Generations.Add(0);
+				Alive.Add(false);
+			}
+		}
+		new(GetSlot(index)) T(Forward<ArgsType>(Args)...);
+		Alive[index] = true;
+		AliveCount++;
+		FPulseStructPoolHandle handle;
+		handle.Index = index;
+		handle.Generation = Generations[index];
+		handle.Epoch = Epoch;
+		return handle;
+	}
+
+	// Get the element pointed by the handle, or nullptr if it was released.
+	T* Get(const FPulseStructPoolHandle& Handle)
+	{
+		return IsValid(Handle) ? GetSlot(Handle.Index) : nullptr;
+	}
+
+	const T* Get(const FPulseStructPoolHandle& Handle) const
+	{
+		return IsValid(Handle) ? GetSlot(Handle.Index) : nullptr;
+	}
+
+	bool IsValid(const FPulseStructPoolHandle& Handle) const
+	{
+		return Handle.Epoch == Epoch && Handle.Index < UsedSlots && Alive[Handle.Index] && Generations[Handle.Index] == Handle.Generation;
+	}
+
+	// Destroy the element and give its slot back to the pool.
+	bool Release(const FPulseStructPoolHandle& Handle)
+	{
+		if (!IsValid(Handle))
+			return false;
+		DestructItem(GetSlot(Handle.Index));
+		Alive[Handle.Index] = false;
+		Generations[Handle.Index]++;
+		FreeSlots.Add(Handle.Index);
+		AliveCount--;
+		return true;
+	}
+
+	// Release every element at once. Memory is kept for the next elements.
+	void Reset()
+	{
+		DestroyAlive();
+		if (UsedSlots > 0)
+			Alive.SetRange(0, UsedSlots, false);
+		FreeSlots.Reset();
+		UsedSlots = 0;
+		AliveCount = 0;
+		Epoch++;
+	}
+
+	// Release every element and free the memory.
+	void Empty()
+	{
+		Reset();
+		Chunks.Empty();
+		Generations.Empty();
+		Alive.Empty();
+		FreeSlots.Empty();
+	}
+
+	// Make sure Count elements can be acquired without allocating.
+	void Reserve(int32 Count)
+	{
+		while (Generations.Num() < Count)
+		{
+			if (Generations.Num() / ChunkSize >= static_cast<uint32>(Chunks.Num()))
+				Chunks.Add(MakeUnique<TTypeCompatibleBytes<T>[]>(ChunkSize));
+			Generations.Add(0);
+			Alive.Add(false);
+		}
+	}
+
+	int32 Num() const { return AliveCount; }
+
+	int32 Capacity() const { return Chunks.Num() * ChunkSize; }
+
+	// Call Action(T&) on every alive element.
+	template <typename FunctorType>
+	void ForEach(FunctorType&& Action)
+	{
+		for (uint32 i = 0; i < UsedSlots; i++)
+		{
+			if (Alive[i])
+				Action(*GetSlot(i));
+		}
+	}
+
+private:
+	T* GetSlot(uint32 Index) const
+	{
+		return Chunks[Index / ChunkSize][Index % ChunkSize].GetTypedPtr();
+	}
+
+	void DestroyAlive()
+	{
+		if constexpr (!TIsTriviallyDestructible<T>::Value)
+		{
+			for (uint32 i = 0; i < UsedSlots; i++)
+			{
+				if (Alive[i])
+					DestructItem(GetSlot(i));
+			}
+		}
+	}
+
+	TArray<TUniquePtr<TTypeCompatibleBytes<T>[]>> Chunks;
+	TArray<uint32> Generations;
+	TBitArray<> Alive;
+	TArray<uint32> FreeSlots;
+	// Slots handed out since the last reset. Slots above are never used yet.
+	uint32 UsedSlots = 0;
+	int32 AliveCount = 0;
+	uint32 Epoch = 0;
+};
@@ -5,11 +5,17 @@
 #include "CoreMinimal.h"
 #include "PulseTweenTypes.h"
 #include "Containers/SpscQueue.h"
+#include "Engine/EngineTypes.h"
 #include "Core/PulseCoreTypes.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "PulseTween.generated.h"
 
 
+class AActor;
+class USceneComponent;
+class UMaterialInstanceDynamic;
+class UWidget;
+
 
 /**
  * Pulse Tween tickable world sub-System
@@ -63,6 +69,15 @@ public:
 
 	bool GetTweenInstance(const FGuid& Guid, FPulseTweenInstance& OutInstance);
 
+	// Get the stable handle of an active tween. Faster than its UID for repeated lookups.
+	FPulseTweenHandle GetTweenHandle(const FGuid& Guid) const;
+
+	// Get the timing state of an active tween from its handle, or nullptr if it's no longer active. The pointer is only valid until the next tick.
+	const FPulseTweenTiming* FindTweenTiming(const FPulseTweenHandle& Handle) const;
+
+	// Get the eased value of an active tween from its handle, as computed by the last update.
+	bool GetTweenValue(const FPulseTweenHandle& Handle, float& OutTweenValue) const;
+
 	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening")
 	bool PauseTweenInstance(const FGuid& Guid);
 
@@ -78,19 +93,87 @@ public:
 	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening")
 	bool CancelTweenInstance(const FGuid& Guid);
 
+	// Pause every tween of a group, including the ones started later, until the group is resumed.
+	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening|Group")
+	void PauseTweenGroup(FName Group);
+
+	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening|Group")
+	void ResumeTweenGroup(FName Group);
+
+	// Cancel every tween of a group started so far.
+	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening|Group")
+	void CancelTweenGroup(FName Group);
+
+	// Scale the delta time of every tween of a group.
+	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening|Group")
+	void SetTweenGroupTimeScale(FName Group, float TimeScale = 1);
+
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Group")
+	bool IsTweenGroupPaused(FName Group) const;
+
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Group")
+	float GetTweenGroupTimeScale(FName Group) const;
+
 	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening")
 	bool CancelSequence(const FGuid& Guid);
 
+	// Subscribe to the events of a single tween or sequence. Subscriptions end with the tween or the sequence.
+	FDelegateHandle SubscribeToTween(const FGuid& TweenOrSequenceID, FPulseTweenNativeEvent::FDelegate&& Callback);
+
+	// Remove a subscription made with SubscribeToTween.
+	bool UnsubscribeFromTween(const FGuid& TweenOrSequenceID, FDelegateHandle Handle);
+
+	// Remove every subscription of an object to a tween or sequence.
+	bool UnsubscribeFromTween(const FGuid& TweenOrSequenceID, const void* UserObject);
+
+	// Set the number of active tweens from which they are updated on several threads. Use < 0 to always update on the game thread.
+	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening")
+	void SetMultiThreadThreshold(int32 TweenCount);
+
+	// Evaluate the costly eases (sine, expo, circ, elastic, bounce) from precomputed tables of SampleCount samples instead of analytically.
+	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening")
+	void SetEaseLookupTables(bool bEnable, int32 SampleCount = 256);
+
 private:
 	// Index-Code; code-> 1= pause, 2-resume, 3-cancel, 4-Reset
 	TMap<FGuid, int32> _tweenStatusChangeRequest;
-	TArray<FPulseTweenInstance> _tweenInstances;
-	TMap<FGuid, int32> _tweenInstanceIndexesMap;
+	// Active tweens as parallel arrays: the timing state updated each frame, the identity data, and the eased values.
+	TArray<FPulseTweenTiming> _tweenTimings;
+	TArray<FPulseTweenColdData> _tweenColdData;
+	TArray<float> _tweenValues;
+	// Every tween uses the default ease parameters, so a single evaluator serves them all.
+	FPulseEaseEvaluator _easeEvaluator;
+	// Lookup tables per ease, null for eases evaluated analytically. Shared with other tween systems using the same parameters.
+	TArray<TSharedPtr<const FPulseEaseLUT>> _easeTables;
+	// Baked ease curves, indexed by FPulseTweenTiming::CurveTable.
+	TArray<FPulseEaseLUT> _curveTables;
+	TMap<FObjectKey, int32> _curveTableIndexes;
+	int32 _easeLUTSamples = 256;
+	// Handles of the active tweens, index for index.
+	FPulseTweenSlotMap _tweenSlots;
+	TMap<FGuid, FPulseTweenHandle> _tweenHandles;
+	// Group states, indexed by FPulseTweenTiming::Group. The default group is at index 0.
+	TArray<FPulseTweenGroupState> _tweenGroups;
+	TMap<FName, int32> _tweenGroupIndexes;
+	// Owners of the tweens attached to them. Actors report their end through their events, other owners are checked a few per tick.
+	TArray<FPulseTweenOwnerEntry> _tweenOwners;
+	TMap<FObjectKey, int32> _tweenOwnerIndexes;
+	TArray<FObjectKey> _endedOwners;
+	int32 _ownerSweepCursor = 0;
+	// Number of owners checked for validity each tick.
+	static constexpr int32 OwnerSweepBudget = 32;
 	TSpscQueue<FPulseTweenInstance> _newTweensQueue;
 	TArray<FPulseTweenSequence> _ActiveSequences;
+	// Sequence lookup by ID, and sequence of each step tween.
+	TMap<FGuid, int32> _sequenceIndexes;
+	TMap<FGuid, FGuid> _stepSequenceIDs;
+	// Steps of the active sequences, ready to start. Each sequence owns a contiguous range.
+	TArray<FPulseTweenTiming> _sequenceStepTimings;
+	TArray<FPulseTweenColdData> _sequenceStepColdData;
 
 	TArray<int32> _reusedIndexList;
-	TSpscQueue<int32> _reusedIndexQueue;
+	// One buffer per chunk of the parallel update, kept between frames.
+	TArray<FPulseTweenTickBuffer> _tickBuffers;
 	TArray<FGuid> _unUsedGUIDs;
 	TSet<FGuid> _updatingSet;
 	TSet<FGuid> _startedSet;
@@ -102,16 +185,86 @@ private:
 	TSet<FGuid> _loopSet;
 	TSet<FGuid> _sequenceCompletedSet;
 	TSet<FGuid> _sequenceMoveNextSet;
-	TSet<FGuid> _sequenceChkSet;
+	// Per tween and per sequence subscribers. Shared so a dispatch survives the subscription being removed by a callback.
+	TMap<FGuid, TSharedPtr<FPulseTweenNativeEvent>> _tweenSubscribers;
+	TArray<FPulseTweenPendingEvent> _pendingTweenEvents;
+	// Targets written directly by the tweens, one batch per target type.
+	FPulseTweenTargetBatch _targetBatches[static_cast<int32>(EPulseTweenTargetType::Count)];
+	TArray<TPair<FGuid, FPulseTweenTarget>> _newTweenTargets;
+	// Whether anything is bound to the global events this frame. Sets are only filled for them.
+	bool _bGlobalEventsBound = false;
 	UPROPERTY()
 	TObjectPtr<UWorld> _world;
 	int32 _tweenCountMT = -1;
+	// Number of tweens updated by a single parallel task.
+	static constexpr int32 TweenUpdateChunkSize = 512;
 
 protected:
 	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
-	bool AddToStatusSet(const FPulseTweenInstance& tweenInstance, FRWLock& Lock);
+	bool AddToStatusSet(int32 TweenIndex);
+
+	// Check if the status of a tween is reported through an event.
+	static bool HasStatusEvent(EPulseTweenStatus Status);
+
+	// Get the subscriber event matching a tween status.
+	static bool GetStatusEvent(EPulseTweenStatus Status, EPulseTweenEvent& OutEvent);
+
+	// Queue an event for the subscribers of a tween or sequence. If bFinal, the subscription ends here.
+	void QueueTweenEvent_Internal(const FGuid& TweenOrSequenceID, EPulseTweenEvent Event, bool bFinal = false);
+	void DispatchTweenEvents_Internal();
 	bool MustTriggerEvents() const;
 
+	// Get the index of an active tween in the tween arrays, or INDEX_NONE.
+	int32 FindTweenIndex_Internal(const FGuid& Guid) const;
+
+	// Update the tweens in [Start, End[ and record removals and events in Buffer.
+	void UpdateTweenRange_Internal(int32 Start, int32 End, float DeltaTime, float TimeDilation, bool bIsPaused, FPulseTweenTickBuffer& Buffer);
+
+	// Compute the eased values of the tweens in [Start, End[, grouped by ease to evaluate each group in one batch.
+	void EvaluateEases_Internal(int32 Start, int32 End, FPulseTweenTickBuffer& Buffer);
+
+	// Compute the eased value of a single tween.
+	float EvaluateTween_Internal(int32 Index) const;
+
+	// Get the table of an ease curve, baking it the first time.
+	int32 GetCurveTable_Internal(const UCurveFloat* Curve);
+
+	void AddTween_Internal(const FPulseTweenInstance& TweenInstance);
+
+	// Join a new tween to its group, then queue it to be added on the next tick.
+	void EnqueueTween_Internal(FPulseTweenInstance TweenInstance);
+
+	int32 FindOrAddTweenGroup_Internal(FName Group);
+
+	FPulseTweenSequence* FindSequence_Internal(const FGuid& SequenceID);
+	const FPulseTweenSequence* FindSequence_Internal(const FGuid& SequenceID) const;
+
+	// Start the next step of a sequence in place of its ended step tween. Return false if the sequence is over and the tween must be removed.
+	bool AdvanceSequence_Internal(int32 TweenIndex);
+	void RemoveSequenceAt_Internal(int32 SequenceIndex);
+
+	// Register a tween attached to its owner, or cancel it if the owner is already gone.
+	void RegisterTweenOwner_Internal(int32 TweenIndex);
+	void UnregisterTweenOwner_Internal(int32 TweenIndex);
+	void RemoveTweenOwnerAt_Internal(int32 EntryIndex);
+
+	// Cancel the tweens of the owners that ended, and of the stale owners found by the sweep.
+	void CancelEndedOwnersTweens_Internal();
+
+	UFUNCTION()
+	void OnTweenOwnerDestroyed_Internal(AActor* DestroyedActor);
+
+	UFUNCTION()
+	void OnTweenOwnerEndPlay_Internal(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+	const FPulseTweenGroupState* FindTweenGroup_Internal(FName Group) const;
+
+	// Check and resolve a target, then bind it to an active tween.
+	bool BindTarget_Internal(const FGuid& TweenID, const FPulseTweenTarget& Target);
+
+	// Write the tween values to their targets, batch by batch.
+	void ApplyTargets_Internal();
+	void RemoveTweenAt_Internal(int32 Index);
+
 	FGuid GetTweenNewGuid();
 
 public:
@@ -127,6 +280,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening")
 	void DebugTween(FLinearColor Color);
 
+	// Get the number of active tween instances
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening")
+	int32 GetActiveTweenCount() const;
+
 	// Check if the tween ID is a valid and point to an active tween instance
 	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening")
 	bool IsActiveTween(const FGuid& TweenGUID) const;
@@ -172,6 +329,53 @@ public:
 	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening", meta=(AdvancedDisplay = 3, WorldContext = "Owner", AutoCreateRefTerm = "TweenParams"))
 	bool CreateNewSequence(const UObject* Owner, FGuid& OutSequenceID, const TArray<FTweenParams>& TweenParams, int32 SequenceLoops = 0, bool bAttachToOwner = false);
 
+	/**
+	 * @brief Create a tween instance writing to a target and start tweening.
+	 * @param Owner The object from which to get the actual world we're tweening in
+	 * @param OutTweenID The output tween UID
+	 * @param TweenParams The parameters of the tween.
+	 * @param Target What the tween writes to, and from which to which value.
+	 * @param bAttachToOwner Bound the lifetime of this tween instance to the owning object (the world context object this function is called from)
+	 **/
+	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening", meta=(AdvancedDisplay = 5, WorldContext = "Owner", AutoCreateRefTerm = "Target"))
+	bool CreateNewTargetTween(const UObject* Owner, FGuid& OutTweenID, FTweenParams TweenParams, const FPulseTweenTarget& Target, bool bAttachToOwner = false);
+
+	// Make a target tweening an actor world transform.
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Targets")
+	static FPulseTweenTarget MakeActorTransformTarget(AActor* Actor, const FTransform& From, const FTransform& To);
+
+	// Make a target tweening a scene component world transform.
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Targets")
+	static FPulseTweenTarget MakeComponentTransformTarget(USceneComponent* Component, const FTransform& From, const FTransform& To);
+
+	// Make a target tweening a scene component relative location.
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Targets")
+	static FPulseTweenTarget MakeRelativeLocationTarget(USceneComponent* Component, const FVector& From, const FVector& To);
+
+	// Make a target tweening a scalar parameter of a dynamic material instance.
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Targets")
+	static FPulseTweenTarget MakeMaterialScalarTarget(UMaterialInstanceDynamic* Material, FName ParameterName, float From, float To);
+
+	// Make a target tweening a vector parameter of a dynamic material instance.
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Targets")
+	static FPulseTweenTarget MakeMaterialVectorTarget(UMaterialInstanceDynamic* Material, FName ParameterName, const FLinearColor& From, const FLinearColor& To);
+
+	// Make a target tweening a widget render opacity.
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Targets")
+	static FPulseTweenTarget MakeWidgetOpacityTarget(UWidget* Widget, float From, float To);
+
+	// Make a target tweening a widget render transform. Shear is left untouched.
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Targets")
+	static FPulseTweenTarget MakeWidgetTransformTarget(UWidget* Widget, FVector2D FromTranslation, FVector2D ToTranslation, FVector2D FromScale, FVector2D ToScale, float FromAngle,
+	                                                   float ToAngle);
+
+	// Make a target tweening a property from its path ("Member.SubMember"). Supports float, double, Vector, Vector2D, Rotator and LinearColor properties.
+	UFUNCTION(BlueprintPure, Category="PulseCore|Tweening|Targets")
+	static FPulseTweenTarget MakePropertyTarget(UObject* Object, const FString& PropertyPath, const FVector4& From, const FVector4& To);
+
 	// Start tweening Tween Instance and return it's UID.
 	static FGuid Tween(const UObject* Owner, const FPulseTweenInstance& TweenInstance);
+
+	// Start tweening Tween Instance writing to a target and return it's UID.
+	static FGuid TweenTarget(const UObject* Owner, const FPulseTweenInstance& TweenInstance, const FPulseTweenTarget& Target);
 };
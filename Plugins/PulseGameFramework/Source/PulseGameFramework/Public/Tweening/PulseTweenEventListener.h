@@ -16,10 +16,22 @@ class PULSEGAMEFRAMEWORK_API UPulseTweenEventListener : public UActorComponent
 public:
 	// Sets default values for this component's properties
 	UPulseTweenEventListener();
-	virtual void PostInitProperties() override;
+	virtual void BeginPlay() override;
 	virtual void BeginDestroy() override;
 
+	// Forward the events of a tween or a sequence through OnTweenEvent, until it ends or StopListeningToTween is called.
+	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening")
+	bool ListenToTween(const FGuid& TweenOrSequenceID);
+
+	UFUNCTION(BlueprintCallable, Category="PulseCore|Tweening")
+	bool StopListeningToTween(const FGuid& TweenOrSequenceID);
+
 protected:
+	TSet<FGuid> _listenedTweens;
+
+	void OnTweenEvent_Func(const FGuid& TweenID, EPulseTweenEvent Event);
+	void BindGlobalEvents_Internal(bool bBind);
+
 	UFUNCTION()
 	void OnTweenUpdateEvent_Func(TSet<FGuid> TweenUIDSet);
 	UFUNCTION()
@@ -42,6 +54,14 @@ protected:
 	void OnTweenSequenceCompletedEvent_Func(TSet<FGuid> TweenUIDSet);
 
 public:
+	// Forward the events of every tween through the set events below. Costly with many tweens, disable it when only ListenToTween is used.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="PulseCore|Tweening")
+	bool bListenToAllTweens = true;
+
+	// Events of the tweens and sequences passed to ListenToTween
+	UPROPERTY(BlueprintAssignable, Category="PulseCore|Tweening")
+	FTweenEvent OnTweenEvent;
+
 	UPROPERTY(BlueprintAssignable, Category="PulseCore|Tweening")
 	FTweenIDTriggerEvent OnTweenUpdateEvent;
 
@@ -18,26 +18,11 @@ class PULSEGAMEFRAMEWORK_API UPulseTweenFloatNode : public UBlueprintAsyncAction
 	GENERATED_BODY()
 
 protected:
-	UFUNCTION()
-	void OnUpdate_Internal(TSet<FGuid> Set);	
-	UFUNCTION()
-	void OnStarted_Internal(TSet<FGuid> Set);
-	UFUNCTION()
-	void OnPaused_Internal(TSet<FGuid> Set);
-	UFUNCTION()
-	void OnResumed_Internal(TSet<FGuid> Set);
-	UFUNCTION()
-	void OnPingPong_Internal(TSet<FGuid> Set);
-	UFUNCTION()
-	void OnLooped_Internal(TSet<FGuid> Set);
-	UFUNCTION()
-	void OnCompleted_Internal(TSet<FGuid> Set);
-	UFUNCTION()
-	void OnSequenceCompleted_Internal(TSet<FGuid> Set);
-	UFUNCTION()
-	void OnSequenceMoveNext_Internal(TSet<FGuid> Set);
-	UFUNCTION()
-	void OnCancelled_Internal(TSet<FGuid> Set);
+	FDelegateHandle _tweenSubscription;
+	FDelegateHandle _sequenceSubscription;
+
+	void OnTweenEvent_Internal(const FGuid& ID, EPulseTweenEvent Event);
+	void SubscribeToCurrentTween_Internal();
 	
 public:
 	TArray<FTweenParams> TweenParams;
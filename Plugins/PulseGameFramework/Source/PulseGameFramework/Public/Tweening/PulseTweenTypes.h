@@ -2,9 +2,13 @@
 
 #pragma once
 #include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
 #include "PulseTweenTypes.generated.h"
 
 
+class UCurveFloat;
+
+
 const float BACK_INOUT_OVERSHOOT_MODIFIER = 1.525f;
 const float BOUNCE_R = 1.0f / 2.75f; // reciprocal
 const float BOUNCE_K1 = BOUNCE_R; // 36.36%
@@ -70,6 +74,46 @@ enum class EPulseTweenStatus: uint8
 	Completed,
 };
 
+// Event reported to the subscribers of a tween or a sequence
+UENUM(BlueprintType)
+enum class EPulseTweenEvent: uint8
+{
+	Update,
+	Started,
+	Paused,
+	Resumed,
+	PingPongApex,
+	Looped,
+	Completed,
+	Cancelled,
+	SequenceMoveNext,
+	SequenceCompleted,
+};
+
+// What a target tween writes its value to
+UENUM(BlueprintType)
+enum class EPulseTweenTargetType: uint8
+{
+	None,
+	// Actor world transform
+	ActorTransform,
+	// Scene component world transform
+	ComponentTransform,
+	// Scene component relative location
+	RelativeLocation,
+	// Dynamic material instance scalar parameter
+	MaterialScalar,
+	// Dynamic material instance vector parameter
+	MaterialVector,
+	// Widget render opacity
+	WidgetOpacity,
+	// Widget render transform
+	WidgetTransform,
+	// Float, double, Vector, Vector2D, Rotator or LinearColor property, from a dot separated path
+	Property,
+	Count UMETA(Hidden),
+};
+
 USTRUCT(BlueprintType)
 struct FTweenParams
 {
@@ -116,6 +160,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening|Reverse")
 	EPulseTweenEase ReverseEasing = EPulseTweenEase::Linear;
 
+	// Custom ease curve, replacing both easing types. Its time range is mapped to [0-1], and it is baked to a lookup table when the tween starts.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening|Forward")
+	TObjectPtr<UCurveFloat> EaseCurve = nullptr;
+
+	// Group of the tween, to pause, resume, cancel or time scale it along with the rest of the group. None is the default group.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening|System")
+	FName Group = NAME_None;
+
 	friend bool operator==(const FTweenParams& Lhs, const FTweenParams& RHS)
 	{
 		return Lhs.ForwardDuration == RHS.ForwardDuration
@@ -127,7 +179,9 @@ public:
 			&& Lhs.TweenWhenPaused == RHS.TweenWhenPaused
 			&& Lhs.UseTimeDilation == RHS.UseTimeDilation
 			&& Lhs.ForwardEasing == RHS.ForwardEasing
-			&& Lhs.ReverseEasing == RHS.ReverseEasing;
+			&& Lhs.ReverseEasing == RHS.ReverseEasing
+			&& Lhs.EaseCurve == RHS.EaseCurve
+			&& Lhs.Group == RHS.Group;
 	}
 
 	friend bool operator!=(const FTweenParams& Lhs, const FTweenParams& RHS)
@@ -136,9 +190,50 @@ public:
 	}
 };
 
+// A target a tween writes to directly, from a start to an end value.
+USTRUCT(BlueprintType)
+struct FPulseTweenTarget
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening")
+	EPulseTweenTargetType Type = EPulseTweenTargetType::None;
+
+	// The actor, scene component, dynamic material instance, widget or property owner.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening")
+	TWeakObjectPtr<UObject> Object = nullptr;
+
+	// The material parameter name, or the property path ("Member.SubMember") for property targets.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening")
+	FString Path;
+
+	// Transform targets. Widget transforms use the X and Y of translation and scale.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening")
+	FTransform FromTransform = FTransform::Identity;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening")
+	FTransform ToTransform = FTransform::Identity;
+
+	// Every other target. Scalars and widget angles use X, vectors XYZ, colors XYZW.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening")
+	FVector4 FromValue = FVector4(0, 0, 0, 0);
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PulseCore|Tweening")
+	FVector4 ToValue = FVector4(0, 0, 0, 0);
+
+	inline FVector4 LerpValue(float Alpha) const { return FromValue + (ToValue - FromValue) * Alpha; }
+
+	// Eases can overshoot [0-1], the rotation is extrapolated the same way.
+	inline FTransform LerpTransform(float Alpha) const
+	{
+		return FTransform(FQuat::Slerp_NotNormalized(FromTransform.GetRotation(), ToTransform.GetRotation(), Alpha).GetNormalized(),
+		                  FMath::Lerp(FromTransform.GetLocation(), ToTransform.GetLocation(), Alpha),
+		                  FMath::Lerp(FromTransform.GetScale3D(), ToTransform.GetScale3D(), Alpha));
+	}
+};
+
 // Responsible for the linear transform math
 USTRUCT()
-struct FPulseEaseEvaluator
+struct PULSEGAMEFRAMEWORK_API FPulseEaseEvaluator
 {
 	GENERATED_BODY()
 
@@ -470,22 +565,169 @@ public:
 			return 1 + 2 * m * m * (2 * m * (s + 1) + s);
 		}
 	}
+
+	friend bool operator==(const FPulseEaseEvaluator& Lhs, const FPulseEaseEvaluator& RHS)
+	{
+		return Lhs.Amplitude == RHS.Amplitude && Lhs.Period == RHS.Period && Lhs.Overshoot == RHS.Overshoot && Lhs.SmoothStepX0 == RHS.SmoothStepX0
+			&& Lhs.SmoothStepX1 == RHS.SmoothStepX1 && Lhs.Steps == RHS.Steps;
+	}
+
+	friend uint32 GetTypeHash(const FPulseEaseEvaluator& Evaluator)
+	{
+		uint32 hash = HashCombine(GetTypeHash(Evaluator.Amplitude), GetTypeHash(Evaluator.Period));
+		hash = HashCombine(hash, GetTypeHash(Evaluator.Overshoot));
+		hash = HashCombine(hash, GetTypeHash(Evaluator.SmoothStepX0));
+		hash = HashCombine(hash, GetTypeHash(Evaluator.SmoothStepX1));
+		return HashCombine(hash, GetTypeHash(Evaluator.Steps));
+	}
+
+	// Evaluate an ease at time t [0-1].
+	float Evaluate(EPulseTweenEase Ease, float t) const;
+
+	// Evaluate the same ease for Count times at once. Vectorized for the eases that have a closed form, scalar for the others.
+	void EvaluateBatch(EPulseTweenEase Ease, const float* InTimes, float* OutValues, int32 Count) const;
 };
 
-// Tweening object. Use GetValue() to get the actual eased value [0-1]
-USTRUCT()
-struct FPulseTweenInstance
+// Ease sampled at regular intervals over [0-1], evaluated with linear interpolation between samples.
+struct PULSEGAMEFRAMEWORK_API FPulseEaseLUT
 {
-	GENERATED_BODY()
+	static constexpr int32 MinSamples = 16;
+	static constexpr int32 MaxSamples = 4096;
+
+	TArray<float> Samples;
+
+	inline bool IsValid() const { return Samples.Num() >= 2; }
+
+	inline float Evaluate(float t) const
+	{
+		const float x = FMath::Clamp(t, 0.0f, 1.0f) * (Samples.Num() - 1);
+		const int32 i = FMath::Min(static_cast<int32>(x), Samples.Num() - 2);
+		return FMath::Lerp(Samples[i], Samples[i + 1], x - i);
+	}
+
+	void EvaluateBatch(const float* InTimes, float* OutValues, int32 Count) const;
+
+	// Eases costly enough to be worth a table: the trigonometric, exponential and piecewise ones. Polynomial eases are faster evaluated.
+	static bool IsWorthTable(EPulseTweenEase Ease);
+
+	static FPulseEaseLUT Bake(const FPulseEaseEvaluator& Evaluator, EPulseTweenEase Ease, int32 SampleCount);
+
+	// Bake a curve, its time range mapped to [0-1].
+	static FPulseEaseLUT Bake(const UCurveFloat* Curve, int32 SampleCount);
+
+	// Sample a curve directly, its time range mapped to [0-1].
+	static float EvaluateCurve(const UCurveFloat* Curve, float t);
+
+	// Get the table of an ease for a parameter set, shared with every user of the same ease, parameters and sample count.
+	static TSharedRef<const FPulseEaseLUT> GetShared(const FPulseEaseEvaluator& Evaluator, EPulseTweenEase Ease, int32 SampleCount);
+};
+
+// Stable handle to a tween instance. Stays valid while the tween lives, and never points to another tween once it's removed.
+struct FPulseTweenHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
 
+	bool IsSet() const { return Index != INDEX_NONE; }
+
+	bool operator==(const FPulseTweenHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FPulseTweenHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FPulseTweenHandle& Handle) { return HashCombine(Handle.Index, Handle.Generation); }
+};
+
+// Generational slot map over a dense array. Handles point to slots, slots point to dense indexes.
+// Removing swaps the last dense element into the freed index, so dense arrays stay packed and nothing is shifted.
+struct FPulseTweenSlotMap
+{
 private:
-	FPulseEaseEvaluator easeEvaluator;
+	TArray<int32> SlotToDense;
+	TArray<uint32> Generations;
+	TArray<int32> DenseToSlot;
+	TArray<int32> FreeSlots;
 
-	TWeakObjectPtr<const UObject> _Owner = nullptr;
+public:
+	int32 Num() const { return DenseToSlot.Num(); }
 
-	FString _ownerName;
+	// Get a handle for a new element appended at the end of the dense arrays (at index Num() before the call).
+	FPulseTweenHandle Add()
+	{
+		int32 slot;
+		if (!FreeSlots.IsEmpty())
+		{
+			slot = FreeSlots.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			slot = SlotToDense.Add(INDEX_NONE);
+			Generations.Add(0);
+		}
+		SlotToDense[slot] = DenseToSlot.Add(slot);
+		FPulseTweenHandle handle;
+		handle.Index = slot;
+		handle.Generation = Generations[slot];
+		return handle;
+	}
 
-	inline EPulseTweenEase GetReverseEase(EPulseTweenEase InEase) const
+	// Get the dense index of the handle, or INDEX_NONE if it was removed.
+	int32 Find(const FPulseTweenHandle& Handle) const
+	{
+		if (!SlotToDense.IsValidIndex(Handle.Index) || Generations[Handle.Index] != Handle.Generation)
+			return INDEX_NONE;
+		return SlotToDense[Handle.Index];
+	}
+
+	// Get the handle of the element at a dense index.
+	FPulseTweenHandle GetHandle(int32 DenseIndex) const
+	{
+		FPulseTweenHandle handle;
+		if (!DenseToSlot.IsValidIndex(DenseIndex))
+			return handle;
+		handle.Index = DenseToSlot[DenseIndex];
+		handle.Generation = Generations[handle.Index];
+		return handle;
+	}
+
+	// Invalidate the handle of the element at a dense index and get a new one. The element stays in place.
+	FPulseTweenHandle Reissue(int32 DenseIndex)
+	{
+		if (!DenseToSlot.IsValidIndex(DenseIndex))
+			return {};
+		Generations[DenseToSlot[DenseIndex]]++;
+		return GetHandle(DenseIndex);
+	}
+
+	// Remove the element at a dense index. The caller must mirror it with RemoveAtSwap(DenseIndex) on its dense arrays.
+	void RemoveAtSwap(int32 DenseIndex)
+	{
+		if (!DenseToSlot.IsValidIndex(DenseIndex))
+			return;
+		const int32 slot = DenseToSlot[DenseIndex];
+		Generations[slot]++;
+		SlotToDense[slot] = INDEX_NONE;
+		FreeSlots.Add(slot);
+		DenseToSlot.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+		if (DenseToSlot.IsValidIndex(DenseIndex))
+			SlotToDense[DenseToSlot[DenseIndex]] = DenseIndex;
+	}
+
+	void Empty()
+	{
+		SlotToDense.Empty();
+		Generations.Empty();
+		DenseToSlot.Empty();
+		FreeSlots.Empty();
+	}
+};
+
+// Hot part of a tween: its parameters and timing state, everything the update reads and writes each frame.
+USTRUCT()
+struct FPulseTweenTiming
+{
+	GENERATED_BODY()
+
+private:
+	static inline EPulseTweenEase GetReverseEase(EPulseTweenEase InEase)
 	{
 		switch (InEase)
 		{
@@ -535,32 +777,11 @@ private:
 	}
 
 public:
-	inline FPulseTweenInstance()
+	inline FPulseTweenTiming()
 	{
 	}
-	
-	inline FPulseTweenInstance(const UObject* Owner, const FTweenParams& Params)
-	{
-		_Owner = MakeWeakObjectPtr(Owner);
-		_ownerName = Owner != nullptr? Owner->GetName() : "";
-		ForwardDuration = Params.ForwardDuration;
-		ReverseDuration = Params.ReverseDuration;
-		PingPong = ReverseDuration > 0;
-		StartDelay = Params.StartDelay;
-		StartDelayRemaining = Params.StartDelay;
-		ReverseDelayDuration = Params.ReverseDelay;
-		LoopDelayDuration = Params.LoopDelay;
-		InfiniteLoop = Params.Loops < 0;
-		TotalLoops = FMath::Max(Params.Loops, 0);
-		LoopRemaining = TotalLoops;
-		UpdateWhenPaused = Params.TweenWhenPaused;
-		UseTimeDilation = Params.UseTimeDilation;
-		Easing = Params.ForwardEasing;
-		ReverseUpdateEasing = Params.ReverseEasing;
-		LoopedOnce = false;
-	}
 
-	inline FPulseTweenInstance(const FTweenParams& Params)
+	inline FPulseTweenTiming(const FTweenParams& Params)
 	{
 		ForwardDuration = Params.ForwardDuration;
 		ReverseDuration = Params.ReverseDuration;
@@ -579,17 +800,6 @@ public:
 		LoopedOnce = false;
 	}
 
-	inline FString ToString() const
-	{
-		const FGuid guid = Identifier;
-		FString status = FString::Printf(TEXT("%s"), *UEnum::GetValueAsString(Status));
-		FString enumName;
-		status.Split("::", &enumName, &status);
-		return FString::Printf(TEXT("ID %s: Status: %s, Time: %lf/%lf ,Loops: %d%s"), *guid.ToString(), *status,
-										  Time, GetDuration(), LoopRemaining,
-										  *FString(_Owner.IsExplicitlyNull()? "" : (_Owner.IsStale(true, true)? " ,Owner is no more" : FString(" , Owner: ").Append(_ownerName))));
-	}
-
 	UPROPERTY()
 	float ForwardDuration = 0;
 	UPROPERTY()
@@ -612,13 +822,14 @@ public:
 	bool UpdateWhenPaused = false;
 	UPROPERTY()
 	bool UseTimeDilation = false;
+	// The tween lifetime is bound to an owner object
+	UPROPERTY()
+	bool AttachedToOwner = false;
 	UPROPERTY()
 	EPulseTweenEase Easing = EPulseTweenEase::Linear;
 	UPROPERTY()
 	EPulseTweenEase ReverseUpdateEasing = EPulseTweenEase::Linear;
 
-	UPROPERTY()
-	FGuid Identifier = {};
 	UPROPERTY()
 	float Time = 0;
 	UPROPERTY()
@@ -637,6 +848,14 @@ public:
 	bool TweenIsPaused = false;
 	UPROPERTY()
 	float OnCompletedDeltaDiff = 0;
+	// Index of the baked ease curve table in the tween system, if the tween eases with a curve.
+	UPROPERTY()
+	int32 CurveTable = INDEX_NONE;
+	// Index of the tween group state in the tween system, and the group cancel count when the tween joined it.
+	UPROPERTY()
+	int32 Group = 0;
+	UPROPERTY()
+	int32 GroupCancelCount = 0;
 
 	inline bool IsComplete() const { return LoopRemaining < 0; }
 
@@ -651,6 +870,17 @@ public:
 		LoopedOnce = false;
 	}
 
+	// End the tween right away, without delta to pass on.
+	inline void Complete()
+	{
+		LoopRemaining = -1;
+		if (Status != EPulseTweenStatus::Completed)
+		{
+			OnCompletedDeltaDiff = 0;
+			Status = EPulseTweenStatus::Completed;
+		}
+	}
+
 	inline float GetDuration() const { return UpdateInReverse ? ReverseDuration : ForwardDuration; }
 
 	inline float GetTotalDuration() const
@@ -661,6 +891,19 @@ public:
 				+ LoopDelayDuration * (TotalLoops));
 	}
 
+	// Linear progress of the current forward or reverse pass [0-1], before easing.
+	inline float GetProgress() const
+	{
+		const float duration = GetDuration();
+		return FMath::Clamp(duration > 0 ? Time / duration : 0, 0, 1);
+	}
+
+	// Ease applied to the progress of the current pass.
+	inline EPulseTweenEase GetCurrentEase() const
+	{
+		return (PingPong && UpdateInReverse) ? GetReverseEase(ReverseUpdateEasing) : Easing;
+	}
+
 	// Consume the difference Abs(Time - Duration) calculated when the tween completed. Useful for sequences to "inject" to next tween instance's delta time.
 	inline bool ConsumeCompletedDeltaDiff(float& OutDeltaDiff)
 	{
@@ -671,19 +914,9 @@ public:
 		return true;
 	}
 
-	inline void Update(float DeltaTime, float TimeDilation = 1, bool bIsPaused = false)
+	inline void Update(float DeltaTime, float TimeDilation = 1, bool bIsPaused = false, bool bGroupPaused = false)
 	{
-		if (!_Owner.IsExplicitlyNull() && _Owner.IsStale(true, true))
-		{
-			LoopRemaining = -1;
-			if (Status != EPulseTweenStatus::Completed)
-			{
-				OnCompletedDeltaDiff = 0;
-				Status = EPulseTweenStatus::Completed;
-			}
-			return;
-		}
-		if (TweenIsPaused)
+		if (TweenIsPaused || bGroupPaused)
 		{
 			if (Status != EPulseTweenStatus::Paused)
 			{
@@ -778,170 +1011,212 @@ public:
 			}
 		}
 	}
+};
 
-	inline float GetValue() const
+// Cold part of a tween: identity and debug data, not touched by the update.
+struct FPulseTweenColdData
+{
+	FGuid Identifier = {};
+	TWeakObjectPtr<const UObject> Owner = nullptr;
+	FString OwnerName;
+	TWeakObjectPtr<const UCurveFloat> EaseCurve = nullptr;
+	FName Group = NAME_None;
+	// Key of the owner in the tween system owner registry, for tweens attached to their owner.
+	FObjectKey OwnerKey;
+	// Sequence of the tween, if the tween is a sequence step.
+	FGuid SequenceID;
+};
+
+// Tweening object. Use GetValue() to get the actual eased value [0-1]
+USTRUCT()
+struct FPulseTweenInstance : public FPulseTweenTiming
+{
+	GENERATED_BODY()
+
+private:
+	FPulseEaseEvaluator easeEvaluator;
+
+	TWeakObjectPtr<const UObject> _Owner = nullptr;
+
+	FString _ownerName;
+
+	TWeakObjectPtr<const UCurveFloat> _easeCurve = nullptr;
+
+	FName _group = NAME_None;
+
+public:
+	inline FPulseTweenInstance()
 	{
-		const float duration = GetDuration();
-		const float Value = FMath::Clamp(duration > 0 ? Time / duration : 0, 0, 1);
-		const EPulseTweenEase InEaseType = (PingPong && UpdateInReverse) ? GetReverseEase(ReverseUpdateEasing) : Easing;
-		float inEase = 0;
-		switch (InEaseType)
+	}
+	
+	inline FPulseTweenInstance(const UObject* Owner, const FTweenParams& Params)
+		: FPulseTweenTiming(Params)
+	{
+		_Owner = MakeWeakObjectPtr(Owner);
+		_ownerName = Owner != nullptr? Owner->GetName() : "";
+		AttachedToOwner = Owner != nullptr;
+		_easeCurve = Params.EaseCurve.Get();
+		_group = Params.Group;
+	}
+
+	inline FPulseTweenInstance(const FTweenParams& Params)
+		: FPulseTweenTiming(Params)
+	{
+		_easeCurve = Params.EaseCurve.Get();
+		_group = Params.Group;
+	}
+
+	// Rebuild an instance from its hot and cold parts.
+	inline FPulseTweenInstance(const FPulseTweenTiming& Timing, const FPulseTweenColdData& ColdData)
+		: FPulseTweenTiming(Timing)
+	{
+		_Owner = ColdData.Owner;
+		_ownerName = ColdData.OwnerName;
+		_easeCurve = ColdData.EaseCurve;
+		_group = ColdData.Group;
+		Identifier = ColdData.Identifier;
+	}
+
+	inline FPulseTweenColdData GetColdData() const
+	{
+		FPulseTweenColdData coldData;
+		coldData.Identifier = Identifier;
+		coldData.Owner = _Owner;
+		coldData.OwnerName = _ownerName;
+		coldData.EaseCurve = _easeCurve;
+		coldData.Group = _group;
+		return coldData;
+	}
+
+	inline FName GetGroupName() const { return _group; }
+
+	inline FString ToString() const
+	{
+		const FGuid guid = Identifier;
+		FString status = FString::Printf(TEXT("%s"), *UEnum::GetValueAsString(Status));
+		FString enumName;
+		status.Split("::", &enumName, &status);
+		return FString::Printf(TEXT("ID %s: Status: %s, Time: %lf/%lf ,Loops: %d%s"), *guid.ToString(), *status,
+										  Time, GetDuration(), LoopRemaining,
+										  *FString(_Owner.IsExplicitlyNull()? "" : (_Owner.IsStale(true, true)? " ,Owner is no more" : FString(" , Owner: ").Append(_ownerName))));
+	}
+
+	UPROPERTY()
+	FGuid Identifier = {};
+
+	inline void Update(float DeltaTime, float TimeDilation = 1, bool bIsPaused = false)
+	{
+		if (!_Owner.IsExplicitlyNull() && _Owner.IsStale(true, true))
 		{
-		default:
-			inEase = Value;
-			break;
-		case EPulseTweenEase::Linear:
-			inEase = easeEvaluator.EaseLinear(Value);
-			break;
-		case EPulseTweenEase::Smoothstep:
-			inEase = easeEvaluator.EaseSmoothstep(Value);
-			break;
-		case EPulseTweenEase::Stepped:
-			inEase = easeEvaluator.EaseStepped(Value);
-			break;
-		case EPulseTweenEase::InSine:
-			inEase = easeEvaluator.EaseInSine(Value);
-			break;
-		case EPulseTweenEase::OutSine:
-			inEase = easeEvaluator.EaseOutSine(Value);
-			break;
-		case EPulseTweenEase::InOutSine:
-			inEase = easeEvaluator.EaseInOutSine(Value);
-			break;
-		case EPulseTweenEase::InQuad:
-			inEase = easeEvaluator.EaseInQuad(Value);
-			break;
-		case EPulseTweenEase::OutQuad:
-			inEase = easeEvaluator.EaseOutQuad(Value);
-			break;
-		case EPulseTweenEase::InOutQuad:
-			inEase = easeEvaluator.EaseInOutQuad(Value);
-			break;
-		case EPulseTweenEase::InCubic:
-			inEase = easeEvaluator.EaseInCubic(Value);
-			break;
-		case EPulseTweenEase::OutCubic:
-			inEase = easeEvaluator.EaseOutCubic(Value);
-			break;
-		case EPulseTweenEase::InOutCubic:
-			inEase = easeEvaluator.EaseInOutCubic(Value);
-			break;
-		case EPulseTweenEase::InQuart:
-			inEase = easeEvaluator.EaseInQuart(Value);
-			break;
-		case EPulseTweenEase::OutQuart:
-			inEase = easeEvaluator.EaseOutQuart(Value);
-			break;
-		case EPulseTweenEase::InOutQuart:
-			inEase = easeEvaluator.EaseInOutQuart(Value);
-			break;
-		case EPulseTweenEase::InQuint:
-			inEase = easeEvaluator.EaseInQuint(Value);
-			break;
-		case EPulseTweenEase::OutQuint:
-			inEase = easeEvaluator.EaseOutQuint(Value);
-			break;
-		case EPulseTweenEase::InOutQuint:
-			inEase = easeEvaluator.EaseInOutQuint(Value);
-			break;
-		case EPulseTweenEase::InExpo:
-			inEase = easeEvaluator.EaseInExpo(Value);
-			break;
-		case EPulseTweenEase::OutExpo:
-			inEase = easeEvaluator.EaseOutExpo(Value);
-			break;
-		case EPulseTweenEase::InOutExpo:
-			inEase = easeEvaluator.EaseInOutExpo(Value);
-			break;
-		case EPulseTweenEase::InCirc:
-			inEase = easeEvaluator.EaseInCirc(Value);
-			break;
-		case EPulseTweenEase::OutCirc:
-			inEase = easeEvaluator.EaseOutCirc(Value);
-			break;
-		case EPulseTweenEase::InOutCirc:
-			inEase = easeEvaluator.EaseInOutCirc(Value);
-			break;
-		case EPulseTweenEase::InElastic:
-			inEase = easeEvaluator.EaseInElastic(Value);
-			break;
-		case EPulseTweenEase::OutElastic:
-			inEase = easeEvaluator.EaseOutElastic(Value);
-			break;
-		case EPulseTweenEase::InOutElastic:
-			inEase = easeEvaluator.EaseInOutElastic(Value);
-			break;
-		case EPulseTweenEase::InBounce:
-			inEase = easeEvaluator.EaseInBounce(Value);
-			break;
-		case EPulseTweenEase::OutBounce:
-			inEase = easeEvaluator.EaseOutBounce(Value);
-			break;
-		case EPulseTweenEase::InOutBounce:
-			inEase = easeEvaluator.EaseInOutBounce(Value);
-			break;
-		case EPulseTweenEase::InBack:
-			inEase = easeEvaluator.EaseInBack(Value);
-			break;
-		case EPulseTweenEase::OutBack:
-			inEase = easeEvaluator.EaseOutBack(Value);
-			break;
-		case EPulseTweenEase::InOutBack:
-			inEase = easeEvaluator.EaseInOutBack(Value);
-			break;
+			Complete();
+			return;
 		}
-		return inEase;
+		FPulseTweenTiming::Update(DeltaTime, TimeDilation, bIsPaused);
+	}
+
+	inline float GetValue() const
+	{
+		if (!_easeCurve.IsExplicitlyNull())
+			return FPulseEaseLUT::EvaluateCurve(_easeCurve.Get(), GetProgress());
+		return easeEvaluator.Evaluate(GetCurrentEase(), GetProgress());
 	}
 };
 
 
+// Tweens attached to the same owner, cancelled together when the owner ends.
+struct FPulseTweenOwnerEntry
+{
+	FObjectKey Key;
+	TWeakObjectPtr<const UObject> Owner = nullptr;
+	TArray<FPulseTweenHandle, TInlineAllocator<4>> Tweens;
+};
+
+
+// State shared by all the tweens of a group. Changing it affects the whole group at once.
+struct FPulseTweenGroupState
+{
+	FName Name = NAME_None;
+	float TimeScale = 1;
+	bool bPaused = false;
+	// Incremented by each group cancel. Tweens that joined the group before are cancelled on their next update.
+	int32 CancelCount = 0;
+};
+
+
+// What a chunk of tweens produced during a parallel update. Merged on the game thread after the update.
+struct FPulseTweenTickBuffer
+{
+	// Indexes of the tweens to remove
+	TArray<int32> Removed;
+	// Indexes of the tweens with a status event to report
+	TArray<int32> Events;
+	// Ease evaluation scratch: tween indexes grouped by ease (curve eases last), their progress and eased values in the same order
+	TArray<int32> EaseOrder;
+	TArray<float> EaseInputs;
+	TArray<float> EaseOutputs;
+
+	void Reset()
+	{
+		Removed.Reset();
+		Events.Reset();
+	}
+};
+
+
+// A target bound to an active tween, with what was resolved when it was bound.
+struct FPulseTweenTargetBinding
+{
+	FPulseTweenHandle Tween;
+	FPulseTweenTarget Target;
+	// Material parameter index, from the dynamic material instance.
+	int32 ParameterIndex = INDEX_NONE;
+	// Properties from the object to the written value, for property targets.
+	TArray<FProperty*, TInlineAllocator<4>> PropertyChain;
+	// Value last written, to skip the writes while the tween is idle.
+	float LastValue = TNumericLimits<float>::Max();
+};
+
+// The bindings of one target type, applied together.
+struct FPulseTweenTargetBatch
+{
+	TArray<FPulseTweenTargetBinding> Bindings;
+};
+
+
 // Tweening in sequence
 USTRUCT()
 struct FPulseTweenSequence
 {
 	GENERATED_BODY()
 
-protected:
-	bool InfiniteLoop = false;
-
 public:
-	int32 CurrentIndex = 0;
-	TArray<FPulseTweenInstance> TweenSequenceInstances;
 	FGuid TweenSequenceID;
+	// Range of the sequence steps in the tween system step store.
+	int32 FirstStep = 0;
+	int32 StepCount = 0;
+	int32 CurrentIndex = 0;
 	int32 LoopCount = 0;
+	bool InfiniteLoop = false;
+	// Set by a reset or a cancel, applied when the current step tween ends.
 	bool wasRestarted = false;
+	bool wasCancelled = false;
 
-	void Reset()
-	{
-		CurrentIndex = 0;
-		TweenSequenceInstances.Empty();
-		InfiniteLoop = LoopCount < 0;
-	}
-
-	bool IsCompleted() const { return !TweenSequenceInstances.IsEmpty() && !TweenSequenceInstances.IsValidIndex(CurrentIndex) && TweenSequenceID.IsValid(); }
+	// Index of the current step in the step store, or INDEX_NONE.
+	inline int32 GetCurrentStep() const { return (CurrentIndex >= 0 && CurrentIndex < StepCount) ? FirstStep + CurrentIndex : INDEX_NONE; }
 
-	int32 ContainsTweenAtIndex(const FGuid& TweenID) const
+	// Go to the next step, looping if needed. Return false when the sequence is over.
+	inline bool MoveNext()
 	{
-		const int32 tIndex = TweenSequenceInstances.IndexOfByPredicate([TweenID](const FPulseTweenInstance& tween)-> bool { return tween.Identifier == TweenID; });
-		return tIndex;
-	}
-
-	// try to go to the next index, try looping and return true if the sequence index is still valid.
-	bool SequenceNext(const TSet<FGuid>& CompletedInstanceSet)
-	{
-		FPulseTweenInstance instance;
-		if (!GetCurrentInstance(instance))
-			return false;
-		if (CompletedInstanceSet.IsEmpty())
-			return false;
-		if (!CompletedInstanceSet.Contains(instance.Identifier))
-			return false;
-		TweenSequenceInstances[CurrentIndex].Reset();
-		if (!wasRestarted)
-			CurrentIndex++;
-		else
+		if (wasRestarted)
+		{
 			wasRestarted = false;
-		if (CurrentIndex >= TweenSequenceInstances.Num())
+			CurrentIndex = 0;
+			return StepCount > 0;
+		}
+		if (wasCancelled || StepCount <= 0)
+			return false;
+		CurrentIndex++;
+		if (CurrentIndex >= StepCount)
 		{
 			if (!InfiniteLoop)
 			{
@@ -949,24 +1224,10 @@ public:
 				if (LoopCount < 0)
 					return false;
 			}
+			CurrentIndex = 0;
 		}
-		CurrentIndex = FMath::Modulo(CurrentIndex, TweenSequenceInstances.Num());
-		return TweenSequenceInstances.IsValidIndex(CurrentIndex);
-	}
-
-	bool GetCurrentInstance(FPulseTweenInstance& OutInstance)
-	{
-		if (!TweenSequenceInstances.IsValidIndex(CurrentIndex))
-			return false;
-		OutInstance = TweenSequenceInstances[CurrentIndex];
 		return true;
 	}
-
-	int32 InstanceIndex(const FGuid& TweenID) const
-	{
-		const int32 idx = TweenSequenceInstances.IndexOfByPredicate([TweenID](const FPulseTweenInstance& tween)-> bool { return tween.Identifier == TweenID; });
-		return idx;
-	}
 };
 
 
@@ -974,3 +1235,16 @@ public:
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FTweenUpdateEvent, float, Value, float, Percentage);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FTweenIDTriggerEvent, TSet<FGuid>, TweenUIDSet);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FTweenEvent, FGuid, TweenID, EPulseTweenEvent, Event);
+
+// Native per-tween event. The ID is the tween's, or the sequence's for sequence events.
+DECLARE_MULTICAST_DELEGATE_TwoParams(FPulseTweenNativeEvent, const FGuid& /*TweenID*/, EPulseTweenEvent /*Event*/);
+
+// An event waiting to be dispatched at the end of the tween update, with the subscribers it goes to.
+struct FPulseTweenPendingEvent
+{
+	FGuid TweenID;
+	EPulseTweenEvent Event = EPulseTweenEvent::Update;
+	TSharedPtr<FPulseTweenNativeEvent> Subscribers;
+};
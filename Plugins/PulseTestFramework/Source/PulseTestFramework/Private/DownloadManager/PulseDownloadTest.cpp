@@ -0,0 +1,386 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "DownloadManager/PulseDownloadTypes.h"
+#include "DownloadManager/PulseDownloadTask.h"
+#include "Misc/FileHelper.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDownloadTreeHashTest, "PulseTest.Download.TreeHashTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDownloadChunkWriterTest, "PulseTest.Download.ChunkWriterTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDownloadChunkMergeTest, "PulseTest.Download.ChunkMergeTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDownloadConnectionTunerTest, "PulseTest.Download.ConnectionTunerTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDownloadChunkSizerTest, "PulseTest.Download.ChunkSizerTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDownloadAdaptiveChunkTest, "PulseTest.Download.AdaptiveChunkTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+
+namespace PulseDownloadTest
+{
+	void MakeTestBytes(TArray<uint8>& OutBytes, int64 Size)
+	{
+		OutBytes.SetNumUninitialized(Size);
+		FRandomStream random(1234);
+		for (int64 i = 0; i < Size; i++)
+			OutBytes[i] = static_cast<uint8>(random.RandRange(0, 255));
+	}
+
+	// Hash the bytes split in parts of PartSize, each part hashed apart then joined, as chunks are.
+	FString HashInParts(const TArray<uint8>& Bytes, int64 PartSize, EPulseDownloadHash HashType)
+	{
+		TArray<uint8> leaves;
+		for (int64 start = 0; start < Bytes.Num(); start += PartSize)
+		{
+			FPulseTreeHasher hasher(HashType);
+			hasher.Update(Bytes.GetData() + start, FMath::Min<int64>(PartSize, Bytes.Num() - start));
+			leaves.Append(hasher.Finish());
+		}
+		return FPulseTreeHasher::DigestLeaves(HashType, leaves);
+	}
+
+	// Write the bytes split in chunk files of PartSize, named as chunk files are.
+	void WriteChunkFiles(const TArray<uint8>& Bytes, int64 PartSize, const FString& BasePath, TArray<FString>& OutPaths)
+	{
+		OutPaths.Reset();
+		for (int64 start = 0; start < Bytes.Num(); start += PartSize)
+		{
+			OutPaths.Add(FString::Printf(TEXT("%s_%d"), *BasePath, OutPaths.Num()));
+			const TArrayView<const uint8> part(Bytes.GetData() + start, static_cast<int32>(FMath::Min<int64>(PartSize, Bytes.Num() - start)));
+			FFileHelper::SaveArrayToFile(part, *OutPaths.Last());
+		}
+	}
+
+	bool FileEquals(const FString& Path, const uint8* Bytes, int64 Size)
+	{
+		TArray<uint8> content;
+		return FFileHelper::LoadFileToArray(content, *Path) && content.Num() == Size && FMemory::Memcmp(content.GetData(), Bytes, Size) == 0;
+	}
+
+	// Run the tuner against a link where each connection adds PerConnection bytes/s, up to SaturationConnections. Return the connection count after each window.
+	TArray<int32> RunTuner(FPulseConnectionTuner& Tuner, int32 SaturationConnections, double PerConnection, int32 WindowCount)
+	{
+		// Sampled every quarter second, the 2 seconds windows close every 8 samples.
+		TArray<int32> connections;
+		const double step = 0.25;
+		double now = 0;
+		Tuner.AddSample(0, now);
+		for (int32 i = 1; connections.Num() < WindowCount; i++)
+		{
+			now += step;
+			const int32 effective = FMath::Min(Tuner.GetConnections(), SaturationConnections);
+			Tuner.AddSample(static_cast<int64>(effective * PerConnection * step), now);
+			if (i % 8 == 0)
+				connections.Add(Tuner.GetConnections());
+		}
+		return connections;
+	}
+
+	// Stands in for a throttled http server: a request waits the latency, then streams at the bandwidth.
+	struct FThrottledServer
+	{
+		double BytesPerSecond = 1048576;
+		double LatencySeconds = 0;
+
+		double Serve(int64 Bytes) const { return LatencySeconds + Bytes / BytesPerSecond; }
+	};
+
+	// Download Size bytes against the server, in chunks sized by the sizer. Return the chunk sizes.
+	TArray<int64> RunSizer(FPulseChunkSizer& Sizer, const FThrottledServer& Server, int64 Size)
+	{
+		TArray<int64> sizes;
+		for (int64 done = 0; done < Size;)
+		{
+			const int64 chunkSize = FMath::Min(Sizer.GetChunkSize(), Size - done);
+			Sizer.AddSample(chunkSize, Server.Serve(chunkSize), Server.LatencySeconds);
+			sizes.Add(chunkSize);
+			done += chunkSize;
+		}
+		return sizes;
+	}
+}
+
+
+bool FDownloadTreeHashTest::RunTest(const FString& Parameters)
+{
+	int result = 0;
+	TArray<uint8> bytes;
+	// Not a multiple of the leaf size, the last leaf is partial.
+	PulseDownloadTest::MakeTestBytes(bytes, FPulseTreeHasher::LeafSize * 3 + 12345);
+	const FString filePath = FPaths::AutomationTransientDir() / TEXT("PulseDownload/TreeHash.bin");
+	FFileHelper::SaveArrayToFile(bytes, *filePath);
+
+	for (const auto hashType : {EPulseDownloadHash::MD5, EPulseDownloadHash::XxHash64})
+	{
+		const FString whole = PulseDownloadTest::HashInParts(bytes, bytes.Num(), hashType);
+		// Streamed in odd sized blocks, as http bodies arrive.
+		FPulseTreeHasher streamed(hashType);
+		for (int64 start = 0; start < bytes.Num(); start += 7919)
+			streamed.Update(bytes.GetData() + start, FMath::Min<int64>(7919, bytes.Num() - start));
+		result += TestEqual(TEXT("Streamed digest"), FPulseTreeHasher::DigestLeaves(hashType, streamed.Finish()), whole);
+		result += TestEqual(TEXT("Hashed size"), streamed.GetHashedSize(), static_cast<int64>(bytes.Num()));
+		result += TestEqual(TEXT("Leaf count"), streamed.Finish().Num(), FPulseTreeHasher::GetDigestSize(hashType) * 4);
+		// Split on leaf boundaries, in chunks of any leaf multiple.
+		result += TestEqual(TEXT("One leaf parts digest"), PulseDownloadTest::HashInParts(bytes, FPulseTreeHasher::LeafSize, hashType), whole);
+		result += TestEqual(TEXT("Two leaves parts digest"), PulseDownloadTest::HashInParts(bytes, FPulseTreeHasher::LeafSize * 2, hashType), whole);
+		result += TestEqual(TEXT("File digest"), FPulseTreeHasher::HashFile(filePath, hashType, 4096), whole);
+		result += TestNotEqual(TEXT("Not split aligned digest"), PulseDownloadTest::HashInParts(bytes, FPulseTreeHasher::LeafSize / 2, hashType), whole);
+	}
+	bytes[bytes.Num() / 2] ^= 0xFF;
+	result += TestNotEqual(TEXT("Corrupted digest"), PulseDownloadTest::HashInParts(bytes, bytes.Num(), EPulseDownloadHash::XxHash64),
+	                       FPulseTreeHasher::HashFile(filePath, EPulseDownloadHash::XxHash64));
+	result += TestTrue(TEXT("Missing file digest"), FPulseTreeHasher::HashFile(filePath + TEXT(".missing"), EPulseDownloadHash::MD5).IsEmpty());
+	IFileManager::Get().Delete(*filePath);
+	return result >= 16;
+}
+
+
+bool FDownloadChunkWriterTest::RunTest(const FString& Parameters)
+{
+	int result = 0;
+	TArray<uint8> bytes;
+	PulseDownloadTest::MakeTestBytes(bytes, FPulseTreeHasher::LeafSize + 54321);
+	const int64 chunkSize = bytes.Num();
+	const int64 firstSession = 600000;
+	const FString chunkPath = FPaths::AutomationTransientDir() / TEXT("PulseDownload/Writer_0");
+	IFileManager::Get().Delete(*chunkPath);
+	{
+		// Small blocks wait in the buffer, a full buffer is flushed, a block larger than the buffer is written through.
+		FPulseChunkFileWriter writer(chunkPath, 0, chunkSize, 4096, EPulseDownloadHash::MD5);
+		result += TestTrue(TEXT("Writer Open"), writer.IsOpen());
+		writer.Receive(bytes.GetData(), 1000);
+		result += TestEqual(TEXT("Buffered"), writer.GetWrittenSize(), static_cast<int64>(0));
+		writer.Receive(bytes.GetData() + 1000, 4000);
+		result += TestEqual(TEXT("Full Buffer Flushed"), writer.GetWrittenSize(), static_cast<int64>(1000));
+		writer.Receive(bytes.GetData() + 5000, 10000);
+		result += TestEqual(TEXT("Large Block Written Through"), writer.GetWrittenSize(), static_cast<int64>(15000));
+		for (int64 start = 15000; start < firstSession; start += 7919)
+			writer.Receive(bytes.GetData() + start, FMath::Min<int64>(7919, firstSession - start));
+		writer.Close();
+		result += TestEqual(TEXT("First Session On Disk"), IFileManager::Get().FileSize(*chunkPath), firstSession);
+		FPulseTreeHasher hasher(EPulseDownloadHash::MD5);
+		hasher.Update(bytes.GetData(), firstSession);
+		result += TestTrue(TEXT("Written Leaves"), writer.GetLeafDigests() == hasher.Finish());
+	}
+	{
+		// Resumed: appended to what's on disk, left to the merge to hash. Bytes past the chunk end are refused.
+		FPulseChunkFileWriter writer(chunkPath, firstSession, chunkSize - firstSession, 4096, EPulseDownloadHash::MD5);
+		bool bAccepted = true;
+		for (int64 start = firstSession; start < chunkSize - 5000; start += 7919)
+			bAccepted &= writer.Receive(bytes.GetData() + start, FMath::Min<int64>(7919, chunkSize - 5000 - start));
+		result += TestTrue(TEXT("Resumed Bytes Accepted"), bAccepted);
+		TArray<uint8> overflow;
+		overflow.Append(bytes.GetData() + chunkSize - 5000, 5000);
+		overflow.AddZeroed(500);
+		result += TestFalse(TEXT("Overflow Refused"), writer.Receive(overflow.GetData(), overflow.Num()));
+		result += TestFalse(TEXT("Full Chunk Refuses"), writer.Receive(bytes.GetData(), 1));
+		writer.Close();
+		result += TestTrue(TEXT("Chunk Content"), PulseDownloadTest::FileEquals(chunkPath, bytes.GetData(), chunkSize));
+		result += TestTrue(TEXT("Resumed Chunk Not Hashed"), writer.GetLeafDigests().IsEmpty());
+	}
+	// The response codes whose body is written.
+	result += TestTrue(TEXT("Partial Content"), UPulseDownloadChunk::IsExpectedResponse(206, 1000));
+	result += TestTrue(TEXT("Whole Body From Start"), UPulseDownloadChunk::IsExpectedResponse(200, 0));
+	result += TestFalse(TEXT("Whole Body Mid Chunk"), UPulseDownloadChunk::IsExpectedResponse(200, 1000));
+	result += TestFalse(TEXT("Error Body"), UPulseDownloadChunk::IsExpectedResponse(416, 0));
+	IFileManager::Get().Delete(*chunkPath);
+	return result >= 15;
+}
+
+
+bool FDownloadChunkMergeTest::RunTest(const FString& Parameters)
+{
+	int result = 0;
+	TArray<uint8> bytes;
+	PulseDownloadTest::MakeTestBytes(bytes, 150000 * 3 + 12345);
+	const int64 partSize = 150000;
+	const FString basePath = FPaths::AutomationTransientDir() / TEXT("PulseDownload/Merge");
+	const FString filePath = FPaths::AutomationTransientDir() / TEXT("PulseDownload/Merged.bin");
+	TArray<FString> chunkPaths;
+	IFileManager::Get().Delete(*filePath);
+
+	// Merged and hashed in one pass.
+	PulseDownloadTest::WriteChunkFiles(bytes, partSize, basePath, chunkPaths);
+	FPulseChunkMergeState state;
+	state.TotalSize = bytes.Num();
+	state.HashType = EPulseDownloadHash::XxHash64;
+	int32 progressCount = 0;
+	result += TestTrue(TEXT("Merged"), UPulseDownloadTask::MergeChunkFiles(chunkPaths, filePath, 4096, state, [&progressCount]() { progressCount++; }));
+	result += TestTrue(TEXT("Merged Content"), PulseDownloadTest::FileEquals(filePath, bytes.GetData(), bytes.Num()));
+	result += TestEqual(TEXT("Merged Size"), state.MergedSize.load(), static_cast<int64>(bytes.Num()));
+	result += TestTrue(TEXT("Progress Reported"), progressCount > 0);
+	result += TestEqual(TEXT("Merged Hash"), state.FileHash, PulseDownloadTest::HashInParts(bytes, partSize, EPulseDownloadHash::XxHash64));
+	result += TestFalse(TEXT("First Chunk Moved"), IFileManager::Get().FileExists(*chunkPaths[0]));
+	IFileManager::Get().Delete(*filePath);
+
+	// Cancelled midway: the first chunk is rolled back, nothing reaches the file path.
+	PulseDownloadTest::WriteChunkFiles(bytes, partSize, basePath, chunkPaths);
+	FPulseChunkMergeState cancelledState;
+	cancelledState.TotalSize = bytes.Num();
+	result += TestFalse(TEXT("Cancelled Merge"), UPulseDownloadTask::MergeChunkFiles(chunkPaths, filePath, 4096, cancelledState,
+	                                                                                    [&cancelledState]() { cancelledState.bCancelled = true; }));
+	result += TestTrue(TEXT("Cancelled First Chunk Truncated"), PulseDownloadTest::FileEquals(chunkPaths[0], bytes.GetData(), partSize));
+	result += TestFalse(TEXT("Cancelled File Absent"), IFileManager::Get().FileExists(*filePath));
+
+	// Not the expected hash: rolled back the same way.
+	FPulseChunkMergeState mismatchState;
+	mismatchState.TotalSize = bytes.Num();
+	mismatchState.HashType = EPulseDownloadHash::MD5;
+	mismatchState.ExpectedHash = TEXT("00000000000000000000000000000000");
+	result += TestFalse(TEXT("Mismatch Merge"), UPulseDownloadTask::MergeChunkFiles(chunkPaths, filePath, 4096, mismatchState, []() {}));
+	result += TestTrue(TEXT("Mismatch Reported"), mismatchState.bHashMismatch);
+	result += TestTrue(TEXT("Mismatch First Chunk Truncated"), PulseDownloadTest::FileEquals(chunkPaths[0], bytes.GetData(), partSize));
+	result += TestFalse(TEXT("Mismatch File Absent"), IFileManager::Get().FileExists(*filePath));
+
+	for (const FString& chunkPath : chunkPaths)
+		IFileManager::Get().Delete(*chunkPath);
+	return result >= 13;
+}
+
+
+bool FDownloadConnectionTunerTest::RunTest(const FString& Parameters)
+{
+	int result = 0;
+	// A link that keeps scaling: the tuner climbs to the max.
+	FPulseConnectionTuner scaling;
+	scaling.Initialize(2, 8, 2);
+	const auto scalingRun = PulseDownloadTest::RunTuner(scaling, 100, 1048576, 12);
+	result += TestTrue(TEXT("Climbs to max"), scalingRun.Last() >= 7);
+
+	// A link saturating at 4 connections: the tuner settles around the knee instead of holding extra connections.
+	FPulseConnectionTuner saturating;
+	saturating.Initialize(1, 16, 2);
+	const auto saturatingRun = PulseDownloadTest::RunTuner(saturating, 4, 1048576, 30);
+	bool bSettled = true;
+	for (int32 i = saturatingRun.Num() - 10; bSettled && i < saturatingRun.Num(); i++)
+		bSettled = saturatingRun[i] >= 3 && saturatingRun[i] <= 5;
+	result += TestTrue(TEXT("Settles around the knee"), bSettled);
+
+	// Bounds
+	FPulseConnectionTuner bounded;
+	bounded.Initialize(3, 3, 2);
+	PulseDownloadTest::RunTuner(bounded, 100, 1048576, 5);
+	result += TestEqual(TEXT("Fixed bounds"), bounded.GetConnections(), 3);
+	return result >= 3;
+}
+
+
+bool FDownloadChunkSizerTest::RunTest(const FString& Parameters)
+{
+	int result = 0;
+	const int64 mb = FPulseTreeHasher::LeafSize;
+	const double target = 10;
+
+	// A slow mobile link: chunks last about the target.
+	FPulseChunkSizer mobile;
+	mobile.Initialize(mb, mb * 100, target, mb * 32);
+	const PulseDownloadTest::FThrottledServer mobileServer{256 * 1024, 0.3};
+	result += TestEqual(TEXT("Starts at min"), mobile.GetChunkSize(), mb);
+	const auto mobileSizes = PulseDownloadTest::RunSizer(mobile, mobileServer, mb * 600);
+	bool bAligned = true;
+	for (int32 i = 0; i < mobileSizes.Num() - 1; i++)
+		bAligned &= mobileSizes[i] % mb == 0;
+	result += TestTrue(TEXT("Aligned sizes"), bAligned);
+	const double mobileSeconds = mobileServer.Serve(mobile.GetChunkSize());
+	result += TestTrue(TEXT("Mobile chunk duration"), mobileSeconds >= target * 0.5 && mobileSeconds <= target * 1.5);
+	result += TestTrue(TEXT("Mobile retry cost"), mobile.GetChunkSize() <= mb * 32);
+
+	// A fast link: the retry cost caps the size.
+	FPulseChunkSizer lan;
+	lan.Initialize(mb, mb * 100, target, mb * 32);
+	PulseDownloadTest::RunSizer(lan, {100.0 * mb, 0.002}, mb * 600);
+	result += TestEqual(TEXT("Fast link capped by retry cost"), lan.GetChunkSize(), mb * 32);
+
+	// High latency: chunks grow for the latency to stay a small part of each request.
+	FPulseChunkSizer nearby;
+	nearby.Initialize(mb, mb * 100, target, mb * 64);
+	PulseDownloadTest::RunSizer(nearby, {2.0 * mb, 0.05}, mb * 600);
+	FPulseChunkSizer faraway;
+	faraway.Initialize(mb, mb * 100, target, mb * 64);
+	const PulseDownloadTest::FThrottledServer farawayServer{2.0 * mb, 5};
+	PulseDownloadTest::RunSizer(faraway, farawayServer, mb * 600);
+	result += TestTrue(TEXT("Latency grows chunks"), faraway.GetChunkSize() > nearby.GetChunkSize());
+	result += TestTrue(TEXT("Latency share"), farawayServer.LatencySeconds / farawayServer.Serve(faraway.GetChunkSize()) <= 0.25);
+	return result >= 7;
+}
+
+
+bool FDownloadAdaptiveChunkTest::RunTest(const FString& Parameters)
+{
+	int result = 0;
+	const int64 mb = FPulseTreeHasher::LeafSize;
+	UPulseDownloadTask* task = NewObject<UPulseDownloadTask>();
+	task->Identifier.Id = FGuid::NewGuid();
+	task->Identifier.FileName = TEXT("Adaptive.bin");
+	task->Identifier.bAdaptiveChunks = true;
+	task->bDoServerSupportRange = true;
+	task->TotalSize = mb * 40 + 12345;
+	task->ChunkSizer.Initialize(mb, mb * 100, 10, mb * 8);
+
+	// Left by an earlier session: a complete chunk at 0, and a partial one at 5 MB.
+	TArray<uint8> bytes;
+	PulseDownloadTest::MakeTestBytes(bytes, mb * 3);
+	FFileHelper::SaveArrayToFile(bytes, *(task->GetChunkDirectory() + TEXT("/Adaptive_0")));
+	bytes.SetNum(mb + mb / 2);
+	FFileHelper::SaveArrayToFile(bytes, *(task->GetChunkDirectory() + TEXT("/Adaptive_5")));
+	const int32 count = task->GenerateChunks(mb * 100);
+	result += TestEqual(TEXT("Resumed chunks"), task->Chunks.Num(), 2);
+	result += TestEqual(TEXT("Chunks and ranges"), count, 4);
+	if (task->Chunks.Num() != 2)
+	{
+		task->DeleteChunkFiles();
+		return false;
+	}
+	result += TestTrue(TEXT("Complete chunk"), task->Chunks[0]->IsCompleted());
+	result += TestEqual(TEXT("Partial chunk end"), task->Chunks[1]->FileEndByte, mb * 7 - 1);
+	result += TestEqual(TEXT("Partial chunk resume"), task->Chunks[1]->LocalSize, mb + mb / 2);
+	result += TestTrue(TEXT("Pending chunks"), task->HasPendingChunks());
+	result += TestFalse(TEXT("Not complete"), task->IsComplete());
+
+	// Cut the rest, each chunk measured against the server stand-in.
+	const PulseDownloadTest::FThrottledServer server{0.5 * mb, 0.2};
+	TArray<int64> carvedSizes;
+	while (UPulseDownloadChunk* chunk = task->CarveChunk())
+	{
+		carvedSizes.Add(chunk->GetTargetSize());
+		task->ChunkSizer.AddSample(chunk->GetTargetSize(), server.Serve(chunk->GetTargetSize()), server.LatencySeconds);
+		if (carvedSizes.Num() > 100)
+			break;
+	}
+	TArray<FInt64Vector2> ranges;
+	task->GetUncoveredRanges(ranges);
+	result += TestTrue(TEXT("Whole file covered"), ranges.IsEmpty());
+	result += TestEqual(TEXT("First cut at min"), carvedSizes.IsEmpty() ? 0 : carvedSizes[0], mb);
+	result += TestTrue(TEXT("Cuts grow"), carvedSizes.Num() > 1 && carvedSizes[carvedSizes.Num() - 2] > carvedSizes[0]);
+	TArray<UPulseDownloadChunk*> sorted;
+	for (const auto& chunk : task->Chunks)
+		sorted.Add(chunk);
+	sorted.Sort([](const UPulseDownloadChunk& A, const UPulseDownloadChunk& B) { return A.FileStartByte < B.FileStartByte; });
+	bool bContiguous = sorted[0]->FileStartByte == 0 && sorted.Last()->FileEndByte == task->TotalSize - 1;
+	bool bAligned = true;
+	bool bRetryCost = true;
+	for (int32 i = 0; i < sorted.Num(); i++)
+	{
+		bContiguous &= i == 0 || sorted[i]->FileStartByte == sorted[i - 1]->FileEndByte + 1;
+		bAligned &= sorted[i]->FileStartByte % mb == 0 && sorted[i]->GetChunkIndex() == sorted[i]->FileStartByte / mb;
+		bRetryCost &= sorted[i]->GetTargetSize() <= mb * 8;
+	}
+	result += TestTrue(TEXT("Contiguous chunks"), bContiguous);
+	result += TestTrue(TEXT("Aligned chunks"), bAligned);
+	result += TestTrue(TEXT("Retry cost"), bRetryCost);
+
+	// A failed chunk keeps a measured size, the rest goes back to the ranges to cut.
+	UPulseDownloadChunk* failed = sorted[sorted.Num() - 2];
+	const int64 failedEnd = failed->FileEndByte;
+	task->ChunkSizer.Initialize(mb, mb * 100, 10, mb * 8);
+	task->DownloadState = EPulseDownloadState::Downloading;
+	task->OnChunkFailed(failed);
+	task->GetUncoveredRanges(ranges);
+	result += TestEqual(TEXT("Failed chunk split"), failed->GetTargetSize(), mb);
+	result += TestTrue(TEXT("Split range to cut"), ranges.Num() == 1 && ranges[0].X == failed->FileEndByte + 1 && ranges[0].Y == failedEnd);
+
+	task->DownloadState = EPulseDownloadState::None;
+	task->DeleteChunkFiles();
+	return result >= 15;
+}
+
+#endif
@@ -0,0 +1,16 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+#include "ObjectPooling/PoolingTestTypes.h"
+
+
+bool UPoolingTestObject::OnPoolQueryNative(const FPoolingParamsView& SpawnData)
+{
+	QueryCount++;
+	const FTransform* spawnTransform = SpawnData.GetTransform();
+	return !spawnTransform || spawnTransform->GetLocation().Z >= 0;
+}
+
+void UPoolingTestObject::OnPoolDispose_Implementation()
+{
+	DisposeCount++;
+}
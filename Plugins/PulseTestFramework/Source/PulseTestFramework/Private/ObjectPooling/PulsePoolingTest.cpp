@@ -0,0 +1,298 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "ObjectPooling/PulsePoolingTypes.h"
+#include "ObjectPooling/PulseObjectPooling.h"
+#include "ObjectPooling/PoolingTestTypes.h"
+#include "UObject/Package.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Core/PulseSystemLibrary.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPoolingStorageTest, "PulseTest.Pooling.StorageTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPoolingStorageCleanUpTest, "PulseTest.Pooling.StorageCleanUpTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPoolingStorageComplexityTest, "PulseTest.Pooling.StorageComplexityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPoolingParamsViewTest, "PulseTest.Pooling.ParamsViewTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPoolingBatchQueryTest, "PulseTest.Pooling.BatchQueryTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPoolingActorEnabledTest, "PulseTest.Pooling.ActorEnabledTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPoolingNetDormancyTest, "PulseTest.Pooling.NetDormancyTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+
+namespace PulsePoolingTest
+{
+	void MakeObjects(int32 Count, TArray<UObject*>& OutObjects)
+	{
+		OutObjects.Reset(Count);
+		for (int32 i = 0; i < Count; i++)
+			OutObjects.Add(NewObject<UObject>(GetTransientPackage()));
+	}
+
+	// Run a fixed number of acquire/release cycles against a pool holding PoolSize objects and return the average time per cycle (ns).
+	double MeasureCycleCost(int32 PoolSize, int32 Cycles)
+	{
+		TArray<UObject*> objects;
+		MakeObjects(PoolSize, objects);
+		FPoolingTypeObjects dormant;
+		FPoolingTypeObjects live;
+		for (auto obj : objects)
+			dormant.Add(obj);
+		FRandomStream random(PoolSize);
+		const double start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Cycles; i++)
+		{
+			// Acquire: dormant -> live
+			UObject* obj = dormant.GetLast();
+			dormant.Remove(obj);
+			live.Add(obj);
+			// Release an arbitrary live object: live -> dormant
+			UObject* other = objects[random.RandRange(0, PoolSize - 1)];
+			if (live.Contains(other))
+			{
+				live.Remove(other);
+				dormant.Add(other);
+			}
+			else
+			{
+				live.Remove(obj);
+				dormant.Add(obj);
+			}
+		}
+		const double elapsed = FPlatformTime::Seconds() - start;
+		return (elapsed * 1e9) / FMath::Max(Cycles, 1);
+	}
+}
+
+
+bool FPoolingStorageTest::RunTest(const FString& Parameters)
+{
+	TArray<UObject*> objects;
+	PulsePoolingTest::MakeObjects(5, objects);
+	FPoolingTypeObjects pool(objects);
+	int result = 0;
+	result += TestEqual(TEXT("Initial Count"), pool.Count(), 5);
+	result += TestFalse(TEXT("Duplicate Add Rejected"), pool.Add(objects[2]));
+	result += TestTrue(TEXT("Remove Middle"), pool.Remove(objects[1]));
+	result += TestFalse(TEXT("Removed Not Contained"), pool.Contains(objects[1]));
+	result += TestTrue(TEXT("Swapped Object Still Contained"), pool.Contains(objects[4]));
+	result += TestTrue(TEXT("Remove Swapped Object"), pool.Remove(objects[4]));
+	result += TestEqual(TEXT("Count After Removes"), pool.Count(), 3);
+	result += TestTrue(TEXT("Replace"), pool.Replace(objects[0], objects[1], false));
+	result += TestTrue(TEXT("Replaced Contained"), pool.Contains(objects[1]) && !pool.Contains(objects[0]));
+	int32 visited = 0;
+	pool.ForAllValid([&visited](UObject*) { visited++; });
+	result += TestEqual(TEXT("Visit All"), visited, 3);
+	return result >= 10;
+}
+
+
+bool FPoolingStorageCleanUpTest::RunTest(const FString& Parameters)
+{
+	TArray<UObject*> objects;
+	PulsePoolingTest::MakeObjects(10, objects);
+	FPoolingTypeObjects pool(objects);
+	// Destroy the two last and two middle objects.
+	for (const int32 i : {2, 5, 8, 9})
+		objects[i]->MarkAsGarbage();
+	int result = 0;
+	result += TestEqual(TEXT("Trim Skips Destroyed Tail"), pool.TrimInvalidLast(), objects[7]);
+	result += TestEqual(TEXT("Count After Trim"), pool.Count(), 8);
+	int32 budget = 3;
+	result += TestFalse(TEXT("Partial Step Not Done"), pool.CleanStep(budget));
+	result += TestEqual(TEXT("Budget Consumed"), budget, 0);
+	int32 steps = 1;
+	budget = 3;
+	while (!pool.CleanStep(budget))
+	{
+		budget = 3;
+		steps++;
+	}
+	result += TestEqual(TEXT("Count After Sweep"), pool.Count(), 6);
+	result += TestFalse(TEXT("Destroyed Removed"), pool.Contains(objects[2]) || pool.Contains(objects[5]));
+	result += TestTrue(TEXT("Alive Kept"), pool.Contains(objects[0]) && pool.Contains(objects[7]));
+	result += TestTrue(TEXT("Sweep Spread Over Steps"), steps >= 2);
+	return result >= 8;
+}
+
+
+bool FPoolingStorageComplexityTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 Cycles = 50000;
+	// Warm up allocators and caches before measuring.
+	PulsePoolingTest::MeasureCycleCost(1000, Cycles);
+	const double smallCost = PulsePoolingTest::MeasureCycleCost(1000, Cycles);
+	const double largeCost = PulsePoolingTest::MeasureCycleCost(10000, Cycles);
+	AddInfo(FString::Printf(TEXT("Pool cycle cost: %.1f ns @1k objects, %.1f ns @10k objects"), smallCost, largeCost));
+	// A linear backend would be ~10x slower at 10k objects. Leave room for cache effects and timer noise.
+	return TestTrue(TEXT("Acquire/Release stays constant-time up to 10k objects"), largeCost < smallCost * 3.0 + 50.0);
+}
+
+
+bool FPoolingParamsViewTest::RunTest(const FString& Parameters)
+{
+	const FTransform spawnTransform(FVector(10, 20, 30));
+	const FPoolingParamsView transformView(spawnTransform);
+	int result = 0;
+	result += TestTrue(TEXT("Transform View Valid"), transformView.IsValid());
+	result += TestTrue(TEXT("Transform View Points To Caller Data"), transformView.GetTransform() == &spawnTransform);
+	result += TestNull(TEXT("Missing Param Is Null"), transformView.GetVector());
+	result += TestFalse(TEXT("Empty View Invalid"), FPoolingParamsView().IsValid());
+
+	FPoolingParams params;
+	params.ValueParams = {1, 2};
+	params.NamesParams.Add("Name");
+	const FPoolingParamsView paramsView(params);
+	result += TestTrue(TEXT("Params View Source"), paramsView.Source == &params);
+	result += TestEqual(TEXT("Typed Value Access"), paramsView.GetValue(1) ? *paramsView.GetValue(1) : 0.f, 2.f);
+	FPoolingParams copy;
+	transformView.ToParams(copy);
+	result += TestTrue(TEXT("Copy To Params"), copy.TransformParams.Num() == 1 && copy.TransformParams[0].GetLocation() == FVector(10, 20, 30));
+	return result >= 7;
+}
+
+
+bool FPoolingBatchQueryTest::RunTest(const FString& Parameters)
+{
+	UWorld* world = UWorld::CreateWorld(EWorldType::Game, false);
+	UPulseObjectPooling* pooling = world ? world->GetSubsystem<UPulseObjectPooling>() : nullptr;
+	if (!pooling)
+	{
+		if (world)
+			world->DestroyWorld(false);
+		return TestNotNull(TEXT("Pooling System"), pooling);
+	}
+	const TSubclassOf<UObject> testClass = UPoolingTestObject::StaticClass();
+	pooling->AffectObjectTypePoolLimit(testClass, 100);
+	int32 activeCount = 0, inactiveCount = 0;
+	int result = 0;
+
+	// One query per spawn transform: the objects refusing theirs go back to the pool.
+	const TArray<FTransform> transforms = {
+		FTransform(FVector(0, 0, 10)), FTransform(FVector(0, 0, -10)), FTransform(FVector(0, 0, 20)),
+		FTransform(FVector(0, 0, -20)), FTransform(FVector(0, 0, 30))
+	};
+	TArray<UObject*> outputs;
+	result += TestEqual(TEXT("Refused Transforms Result"), static_cast<int32>(pooling->QueryObjects(nullptr, testClass, transforms, outputs)),
+	                    static_cast<int32>(EPoolQueryResult::InvalidParams));
+	result += TestEqual(TEXT("Accepted Objects"), outputs.Num(), 3);
+	bool bAllQueried = true;
+	for (const UObject* obj : outputs)
+		bAllQueried &= obj && Cast<UPoolingTestObject>(obj)->QueryCount == 1;
+	result += TestTrue(TEXT("Each Object Queried Once"), bAllQueried);
+	pooling->GetPoolClassCount(testClass, activeCount, inactiveCount);
+	result += TestTrue(TEXT("Refused Objects Dormant"), activeCount == 3 && inactiveCount == 2);
+
+	// Batch dispose: every live object returns to the dormant pool.
+	const TArray<UObject*> firstObjects = outputs;
+	result += TestEqual(TEXT("Disposed Count"), pooling->DisposeObjects(outputs), 3);
+	pooling->GetPoolClassCount(testClass, activeCount, inactiveCount);
+	result += TestTrue(TEXT("Disposed Objects Dormant"), activeCount == 0 && inactiveCount == 5);
+	bool bDisposeNotified = true;
+	for (const UObject* obj : firstObjects)
+		bDisposeNotified &= Cast<UPoolingTestObject>(obj)->DisposeCount == 1;
+	result += TestTrue(TEXT("Dispose Notified"), bDisposeNotified);
+
+	// Dormant objects are reused before any creation.
+	result += TestEqual(TEXT("Reuse Result"), static_cast<int32>(pooling->QueryObjects(nullptr, testClass, 4, outputs, FPoolingParams())),
+	                    static_cast<int32>(EPoolQueryResult::Success));
+	bool bReused = outputs.Num() == 4;
+	for (const UObject* obj : outputs)
+		bReused &= Cast<UPoolingTestObject>(obj)->DisposeCount == 1;
+	result += TestTrue(TEXT("Dormant Objects Reused"), bReused);
+
+	// Past the limit, only the room left is filled.
+	pooling->AffectObjectTypePoolLimit(testClass, 6);
+	result += TestEqual(TEXT("Limit Result"), static_cast<int32>(pooling->QueryObjects(nullptr, testClass, 5, outputs, FPoolingParams())),
+	                    static_cast<int32>(EPoolQueryResult::PoolLimitReached));
+	result += TestEqual(TEXT("Limited Objects"), outputs.Num(), 2);
+	pooling->GetPoolClassCount(testClass, activeCount, inactiveCount);
+	result += TestTrue(TEXT("Pool At Limit"), activeCount == 6 && inactiveCount == 0);
+
+	// Only the objects handed out count as hits or misses, the ones past the limit are counted apart.
+	FPoolClassStats stats;
+	pooling->GetPoolClassStats(testClass, stats);
+	result += TestTrue(TEXT("Hits And Misses"), stats.Hits == 5 && stats.Misses == 4);
+	result += TestEqual(TEXT("Limit Refusals"), stats.LimitRefusals, 3);
+
+	pooling->ClearPool();
+	world->DestroyWorld(false);
+	return result >= 14;
+}
+
+bool FPoolingActorEnabledTest::RunTest(const FString& Parameters)
+{
+	UWorld* world = UWorld::CreateWorld(EWorldType::Game, false);
+	UPulseObjectPooling* pooling = world ? world->GetSubsystem<UPulseObjectPooling>() : nullptr;
+	UObject* actor = pooling ? world->SpawnActor<AActor>() : nullptr;
+	if (!actor)
+	{
+		if (world)
+			world->DestroyWorld(false);
+		return TestNotNull(TEXT("Pooled Actor"), actor);
+	}
+	int result = 0;
+	// A pooled actor reads as disabled while it sleeps in the pool, and enabled once queried again.
+	pooling->AffectObjectTypePoolLimit(AActor::StaticClass(), 10);
+	pooling->RegisterExistingObjectToPool(actor);
+	result += TestTrue(TEXT("Live Actor Enabled"), UPulseSystemLibrary::IsActorEnabled(Cast<AActor>(actor)));
+	pooling->DisposeObject(actor);
+	result += TestFalse(TEXT("Dormant Actor Disabled"), UPulseSystemLibrary::IsActorEnabled(Cast<AActor>(actor)));
+	UObject* queried = nullptr;
+	pooling->QueryObject(nullptr, AActor::StaticClass(), queried, FPoolingParams());
+	result += TestTrue(TEXT("Actor Reused"), queried == actor);
+	result += TestTrue(TEXT("Reused Actor Enabled"), UPulseSystemLibrary::IsActorEnabled(Cast<AActor>(actor)));
+	pooling->ClearPool();
+	world->DestroyWorld(false);
+	return result >= 4;
+}
+
+
+bool FPoolingNetDormancyTest::RunTest(const FString& Parameters)
+{
+	// A listening server world, so dormancy changes reach a net driver.
+	UWorld* world = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& worldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	worldContext.SetCurrentWorld(world);
+	FURL listenUrl;
+	listenUrl.Port = 17777;
+	const bool bListening = world->Listen(listenUrl);
+	AActor* actor = bListening ? world->SpawnActor<AActor>() : nullptr;
+	int result = 0;
+	if (actor)
+	{
+		actor->SetReplicates(true);
+		result += TestTrue(TEXT("Replicated Authority"), actor->GetIsReplicated() && actor->HasAuthority());
+		FNetworkObjectInfo* netInfo = world->GetNetDriver()->FindNetworkObjectInfo(actor);
+		result += TestNotNull(TEXT("Net Object"), netInfo);
+		// Each configured dormancy survives a pool round trip. An initial one was consumed when the channel opened.
+		for (const ENetDormancy dormancy : {DORM_Awake, DORM_DormantAll, DORM_Initial})
+		{
+			const ENetDormancy expectedDormancy = dormancy == DORM_Initial ? DORM_DormantAll : dormancy;
+			actor->NetDormancy = dormancy;
+			FPooledActorDormancy pooled;
+			pooled.SetDormant(actor, true, true);
+			result += TestEqual(TEXT("Net Dormant In Pool"), static_cast<int32>(actor->NetDormancy), static_cast<int32>(DORM_DormantAll));
+			if (netInfo)
+				netInfo->bPendingNetUpdate = false;
+			pooled.SetDormant(actor, false, true);
+			result += TestEqual(FString::Printf(TEXT("Net Dormancy %d Restored"), static_cast<int32>(dormancy)), static_cast<int32>(actor->NetDormancy),
+			                    static_cast<int32>(expectedDormancy));
+			// Even back to a dormant channel, the wake up is sent on the next net update.
+			result += TestTrue(TEXT("Wake Up Replicated"), netInfo && netInfo->bPendingNetUpdate);
+			result += TestFalse(TEXT("Hidden State Restored"), actor->IsHidden());
+		}
+	}
+	else
+	{
+		TestTrue(TEXT("Listening Server"), bListening);
+	}
+	GEngine->DestroyWorldContext(world);
+	world->DestroyWorld(false);
+	return result >= 14;
+}
+
+#endif
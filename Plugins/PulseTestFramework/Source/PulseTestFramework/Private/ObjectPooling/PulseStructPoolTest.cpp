@@ -0,0 +1,139 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "ObjectPooling/PulseStructPool.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStructPoolTest, "PulseTest.Pooling.StructPoolTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStructPoolBenchmark, "PulseTest.Pooling.StructPoolBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+
+namespace PulseStructPoolTest
+{
+	struct FHitRecord
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Normal = FVector::UpVector;
+		float Damage = 0;
+		int32 InstigatorID = INDEX_NONE;
+
+		FHitRecord() = default;
+
+		FHitRecord(const FVector& InLocation, float InDamage, int32 InInstigatorID)
+			: Location(InLocation), Damage(InDamage), InstigatorID(InInstigatorID)
+		{
+		}
+	};
+
+	struct FCountedRecord
+	{
+		int32* LiveCounter = nullptr;
+
+		explicit FCountedRecord(int32* Counter) : LiveCounter(Counter) { (*LiveCounter)++; }
+		~FCountedRecord() { (*LiveCounter)--; }
+	};
+}
+
+
+bool FStructPoolTest::RunTest(const FString& Parameters)
+{
+	using namespace PulseStructPoolTest;
+	TPulseStructPool<FHitRecord, 4> pool;
+	int result = 0;
+	const auto h1 = pool.Acquire(FVector(1, 2, 3), 10.0f, 1);
+	const auto h2 = pool.Acquire(FVector(4, 5, 6), 20.0f, 2);
+	const FHitRecord* firstRecord = pool.Get(h1);
+	for (int32 i = 0; i < 10; i++)
+		pool.Acquire();
+	result += TestEqual(TEXT("Alive Count"), pool.Num(), 12);
+	result += TestTrue(TEXT("Address Stable Across Growth"), pool.Get(h1) == firstRecord && firstRecord->Damage == 10.0f);
+	result += TestTrue(TEXT("Release"), pool.Release(h2));
+	result += TestNull(TEXT("Released Handle Resolves To Null"), pool.Get(h2));
+	const auto h3 = pool.Acquire(FVector::ZeroVector, 30.0f, 3);
+	result += TestEqual(TEXT("Slot Reused"), h3.Index, h2.Index);
+	result += TestNull(TEXT("Stale Handle On Reused Slot"), pool.Get(h2));
+	pool.Reset();
+	result += TestEqual(TEXT("Reset Count"), pool.Num(), 0);
+	result += TestNull(TEXT("Handle Invalid After Reset"), pool.Get(h1));
+
+	int32 liveCounter = 0;
+	{
+		TPulseStructPool<FCountedRecord> countedPool;
+		countedPool.Acquire(&liveCounter);
+		countedPool.Acquire(&liveCounter);
+		const auto released = countedPool.Acquire(&liveCounter);
+		countedPool.Release(released);
+		result += TestEqual(TEXT("Release Destructs"), liveCounter, 2);
+		countedPool.Reset();
+		result += TestEqual(TEXT("Reset Destructs"), liveCounter, 0);
+		countedPool.Acquire(&liveCounter);
+	}
+	result += TestEqual(TEXT("Pool Destruction Destructs"), liveCounter, 0);
+	return result >= 11;
+}
+
+
+bool FStructPoolBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace PulseStructPoolTest;
+	constexpr int32 Frames = 50;
+	constexpr int32 RecordsPerFrame = 5000;
+	int64 checksum = 0;
+
+	// new / delete per record
+	double start = FPlatformTime::Seconds();
+	{
+		TArray<FHitRecord*> records;
+		records.Reserve(RecordsPerFrame);
+		for (int32 frame = 0; frame < Frames; frame++)
+		{
+			for (int32 i = 0; i < RecordsPerFrame; i++)
+				records.Add(new FHitRecord(FVector(i), i, frame));
+			for (auto record : records)
+			{
+				checksum += record->InstigatorID;
+				delete record;
+			}
+			records.Reset();
+		}
+	}
+	const double newDeleteTime = FPlatformTime::Seconds() - start;
+
+	// TArray growing from empty each frame
+	start = FPlatformTime::Seconds();
+	for (int32 frame = 0; frame < Frames; frame++)
+	{
+		TArray<FHitRecord> records;
+		for (int32 i = 0; i < RecordsPerFrame; i++)
+			records.Emplace(FVector(i), i, frame);
+		for (const auto& record : records)
+			checksum += record.InstigatorID;
+	}
+	const double arrayGrowthTime = FPlatformTime::Seconds() - start;
+
+	// Struct pool with a bulk reset per frame
+	start = FPlatformTime::Seconds();
+	{
+		TPulseStructPool<FHitRecord> pool;
+		TArray<FPulseStructPoolHandle> handles;
+		handles.Reserve(RecordsPerFrame);
+		for (int32 frame = 0; frame < Frames; frame++)
+		{
+			for (int32 i = 0; i < RecordsPerFrame; i++)
+				handles.Add(pool.Acquire(FVector(i), i, frame));
+			for (const auto& handle : handles)
+				checksum += pool.Get(handle)->InstigatorID;
+			handles.Reset();
+			pool.Reset();
+		}
+	}
+	const double poolTime = FPlatformTime::Seconds() - start;
+
+	AddInfo(FString::Printf(TEXT("%d frames x %d records: new/delete %.3f ms, TArray growth %.3f ms, struct pool %.3f ms (checksum %lld)"), Frames, RecordsPerFrame,
+	                        newDeleteTime * 1000, arrayGrowthTime * 1000, poolTime * 1000, checksum));
+	return TestTrue(TEXT("Benchmark ran"), checksum > 0);
+}
+
+
+#endif
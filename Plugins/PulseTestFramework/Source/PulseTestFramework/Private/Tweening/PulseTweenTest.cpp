@@ -0,0 +1,557 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Tweening/PulseTween.h"
+#include "Tweening/PulseTweenFloatNode.h"
+#include "Tweening/PulseTweenTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenSlotMapTest, "PulseTest.Tweening.SlotMapTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenMultiThreadBenchmark, "PulseTest.Tweening.MultiThreadBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenSubscriptionTest, "PulseTest.Tweening.SubscriptionTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenEaseBatchTest, "PulseTest.Tweening.EaseBatchTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenPropertyTargetTest, "PulseTest.Tweening.PropertyTargetTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenEaseLUTBenchmark, "PulseTest.Tweening.EaseLUTBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenGroupTest, "PulseTest.Tweening.GroupTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenOwnerLifetimeTest, "PulseTest.Tweening.OwnerLifetimeTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenSequenceTest, "PulseTest.Tweening.SequenceTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenUpdateStressBenchmark, "PulseTest.Tweening.UpdateStressBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenLifecycleBenchmark, "PulseTest.Tweening.LifecycleBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenEventDispatchBenchmark, "PulseTest.Tweening.EventDispatchBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+
+namespace PulseTweenTest
+{
+	UWorld* CreateTestWorld()
+	{
+		return UWorld::CreateWorld(EWorldType::Game, false);
+	}
+
+	void DestroyTestWorld(UWorld* World)
+	{
+		if (World)
+			World->DestroyWorld(false);
+	}
+
+	// Start Count looping tweens of every ease type.
+	void SpawnTweens(UWorld* World, int32 Count)
+	{
+		FTweenParams params;
+		params.ForwardDuration = 1000;
+		params.Loops = -1;
+		const int32 easeCount = static_cast<int32>(EPulseTweenEase::InOutBack) + 1;
+		for (int32 i = 0; i < Count; i++)
+		{
+			params.ForwardEasing = static_cast<EPulseTweenEase>(i % easeCount);
+			UPulseTween::Tween(World, FPulseTweenInstance(params));
+		}
+	}
+
+	// Tick the tween system Ticks times and return the average tick duration (ms).
+	double MeasureTicks(UPulseTween* TweenSystem, int32 Ticks)
+	{
+		const double start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Ticks; i++)
+			TweenSystem->Tick(1.0f / 60);
+		return (FPlatformTime::Seconds() - start) * 1000 / FMath::Max(Ticks, 1);
+	}
+
+	// Start Count tweens as a real game would: mixed eases, finite and infinite loops, ping-pong, and one sequence of 3 steps every 8 tweens.
+	// Return the number of tweens active at once.
+	int32 SpawnMixedTweens(UWorld* World, UPulseTween* TweenSystem, int32 Count, FName Group = NAME_None)
+	{
+		const int32 easeCount = static_cast<int32>(EPulseTweenEase::InOutBack) + 1;
+		FTweenParams params;
+		params.Group = Group;
+		for (int32 i = 0; i < Count; i++)
+		{
+			params.ForwardEasing = static_cast<EPulseTweenEase>(i % easeCount);
+			params.ReverseEasing = static_cast<EPulseTweenEase>((i / 2) % easeCount);
+			params.ForwardDuration = 1 + (i % 5);
+			params.ReverseDuration = (i % 3 == 0) ? 1 : 0;
+			params.Loops = (i % 2 == 0) ? -1 : 3;
+			if (i % 8 == 7)
+			{
+				FGuid sequenceID;
+				TweenSystem->CreateNewSequence(World, sequenceID, {params, params, params}, -1);
+			}
+			else
+			{
+				UPulseTween::Tween(World, FPulseTweenInstance(params));
+			}
+		}
+		return Count;
+	}
+
+	// Append benchmark rows to a CSV file in Saved/Automation, so results can be compared between builds.
+	void WriteCsvRows(const FString& FileName, const TArray<FString>& Rows)
+	{
+		const FString path = FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("PulseTween") / FileName;
+		FString content;
+		if (!FPaths::FileExists(path))
+			content = TEXT("Date,Build,Benchmark,TweenCount,Metric,Value\n");
+		const FString prefix = FString::Printf(TEXT("%s,%s,"), *FDateTime::UtcNow().ToIso8601(), FApp::GetBuildVersion());
+		for (const FString& row : Rows)
+			content += prefix + row + TEXT("\n");
+		FFileHelper::SaveStringToFile(content, *path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+	}
+}
+
+
+bool FTweenSlotMapTest::RunTest(const FString& Parameters)
+{
+	FPulseTweenSlotMap slots;
+	TArray<int32> dense;
+	TArray<FPulseTweenHandle> handles;
+	for (int32 i = 0; i < 4; i++)
+	{
+		handles.Add(slots.Add());
+		dense.Add(i);
+	}
+	int result = 0;
+	result += TestEqual(TEXT("Count"), slots.Num(), 4);
+	// Remove the second element: the last one is swapped in its place.
+	const int32 removed = slots.Find(handles[1]);
+	slots.RemoveAtSwap(removed);
+	dense.RemoveAtSwap(removed);
+	result += TestEqual(TEXT("Removed Handle Invalid"), slots.Find(handles[1]), INDEX_NONE);
+	result += TestEqual(TEXT("Swapped Handle Follows"), dense[slots.Find(handles[3])], 3);
+	result += TestEqual(TEXT("Untouched Handle"), dense[slots.Find(handles[0])], 0);
+	// The freed slot is reused with a new generation.
+	const FPulseTweenHandle reused = slots.Add();
+	dense.Add(4);
+	result += TestEqual(TEXT("Slot Reused"), reused.Index, handles[1].Index);
+	result += TestNotEqual(TEXT("Generation Bumped"), reused.Generation, handles[1].Generation);
+	result += TestEqual(TEXT("Stale Handle Still Invalid"), slots.Find(handles[1]), INDEX_NONE);
+	result += TestEqual(TEXT("Dense To Handle"), slots.GetHandle(slots.Find(reused)) == reused, true);
+	return result >= 8;
+}
+
+bool FTweenMultiThreadBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 TweenCounts[] = {10000, 50000, 100000};
+	const int32 Ticks = 10;
+	bool ran = true;
+	for (const int32 count : TweenCounts)
+	{
+		UWorld* world = PulseTweenTest::CreateTestWorld();
+		UPulseTween* tweenSystem = world ? world->GetSubsystem<UPulseTween>() : nullptr;
+		if (!tweenSystem)
+		{
+			PulseTweenTest::DestroyTestWorld(world);
+			return TestNotNull(TEXT("Tween System"), tweenSystem);
+		}
+		PulseTweenTest::SpawnTweens(world, count);
+		tweenSystem->Tick(0); // Activate the new tweens
+		tweenSystem->SetMultiThreadThreshold(-1);
+		const double singleThreadMs = PulseTweenTest::MeasureTicks(tweenSystem, Ticks);
+		tweenSystem->SetMultiThreadThreshold(1);
+		const double multiThreadMs = PulseTweenTest::MeasureTicks(tweenSystem, Ticks);
+		AddInfo(FString::Printf(TEXT("%d tweens: single thread %.3f ms/tick, multi thread %.3f ms/tick, speedup x%.2f"), count, singleThreadMs, multiThreadMs,
+		                        multiThreadMs > 0 ? singleThreadMs / multiThreadMs : 0));
+		ran &= TestEqual(FString::Printf(TEXT("%d Tweens Active"), count), tweenSystem->GetActiveTweenCount(), count);
+		PulseTweenTest::DestroyTestWorld(world);
+	}
+	return TestTrue(TEXT("Benchmark ran"), ran);
+}
+
+bool FTweenEaseBatchTest::RunTest(const FString& Parameters)
+{
+	// 103 samples: not a multiple of 4, so the scalar tail is covered too. Both ends are included.
+	const int32 sampleCount = 103;
+	TArray<float> times;
+	for (int32 i = 0; i < sampleCount; i++)
+		times.Add(static_cast<float>(i) / (sampleCount - 1));
+	TArray<float> batchValues;
+	batchValues.SetNumZeroed(sampleCount);
+	const FPulseEaseEvaluator evaluator;
+	const int32 easeCount = static_cast<int32>(EPulseTweenEase::InOutBack) + 1;
+	int result = 0;
+	for (int32 e = 0; e < easeCount; e++)
+	{
+		const EPulseTweenEase ease = static_cast<EPulseTweenEase>(e);
+		evaluator.EvaluateBatch(ease, times.GetData(), batchValues.GetData(), sampleCount);
+		float maxError = 0;
+		for (int32 i = 0; i < sampleCount; i++)
+			maxError = FMath::Max(maxError, FMath::Abs(batchValues[i] - evaluator.Evaluate(ease, times[i])));
+		result += TestTrue(FString::Printf(TEXT("%s Batch Matches Scalar (max error %f)"), *UEnum::GetValueAsString(ease), maxError), maxError <= 1e-3f);
+	}
+	return result >= easeCount;
+}
+
+bool FTweenPropertyTargetTest::RunTest(const FString& Parameters)
+{
+	UWorld* world = PulseTweenTest::CreateTestWorld();
+	UPulseTween* tweenSystem = world ? world->GetSubsystem<UPulseTween>() : nullptr;
+	AActor* actor = world ? world->SpawnActor<AActor>() : nullptr;
+	if (!tweenSystem || !actor)
+	{
+		PulseTweenTest::DestroyTestWorld(world);
+		return TestTrue(TEXT("Tween System And Actor"), false);
+	}
+	FTweenParams params;
+	params.ForwardDuration = 1;
+	// A top level property, and one nested in a struct.
+	const FGuid dilationTween = UPulseTween::TweenTarget(world, FPulseTweenInstance(params),
+	                                                     UPulseTween::MakePropertyTarget(actor, TEXT("CustomTimeDilation"), FVector4(0, 0, 0, 0), FVector4(2, 0, 0, 0)));
+	const FGuid intervalTween = UPulseTween::TweenTarget(world, FPulseTweenInstance(params),
+	                                                     UPulseTween::MakePropertyTarget(actor, TEXT("PrimaryActorTick.TickInterval"), FVector4(0, 0, 0, 0), FVector4(4, 0, 0, 0)));
+	const FGuid invalidTween = UPulseTween::TweenTarget(world, FPulseTweenInstance(params),
+	                                                    UPulseTween::MakePropertyTarget(actor, TEXT("NotAProperty"), FVector4(0, 0, 0, 0), FVector4(1, 0, 0, 0)));
+	tweenSystem->Tick(0); // Activate the new tweens and bind their targets
+	tweenSystem->Tick(0.5f);
+	int result = 0;
+	result += TestTrue(TEXT("Tweens Started"), dilationTween.IsValid() && intervalTween.IsValid() && invalidTween.IsValid());
+	result += TestNearlyEqual(TEXT("Property Written"), actor->CustomTimeDilation, 1.0f, 1e-3f);
+	result += TestNearlyEqual(TEXT("Nested Property Written"), actor->PrimaryActorTick.TickInterval, 2.0f, 1e-3f);
+	// Unresolved targets don't stop the tween itself.
+	result += TestTrue(TEXT("Invalid Target Tween Still Active"), tweenSystem->IsActiveTween(invalidTween));
+	PulseTweenTest::DestroyTestWorld(world);
+	return result >= 4;
+}
+
+bool FTweenEaseLUTBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 sampleCount = 100000;
+	const int32 tableSamples = 256;
+	const int32 passes = 20;
+	TArray<float> times;
+	for (int32 i = 0; i < sampleCount; i++)
+		times.Add(static_cast<float>(i) / (sampleCount - 1));
+	TArray<float> analyticValues, tableValues;
+	analyticValues.SetNumZeroed(sampleCount);
+	tableValues.SetNumZeroed(sampleCount);
+	const FPulseEaseEvaluator evaluator;
+	const int32 easeCount = static_cast<int32>(EPulseTweenEase::InOutBack) + 1;
+	int result = 0;
+	int tested = 0;
+	for (int32 e = 0; e < easeCount; e++)
+	{
+		const EPulseTweenEase ease = static_cast<EPulseTweenEase>(e);
+		if (!FPulseEaseLUT::IsWorthTable(ease))
+			continue;
+		tested++;
+		const TSharedRef<const FPulseEaseLUT> table = FPulseEaseLUT::GetShared(evaluator, ease, tableSamples);
+		double start = FPlatformTime::Seconds();
+		for (int32 p = 0; p < passes; p++)
+			evaluator.EvaluateBatch(ease, times.GetData(), analyticValues.GetData(), sampleCount);
+		const double analyticMs = (FPlatformTime::Seconds() - start) * 1000 / passes;
+		start = FPlatformTime::Seconds();
+		for (int32 p = 0; p < passes; p++)
+			table->EvaluateBatch(times.GetData(), tableValues.GetData(), sampleCount);
+		const double tableMs = (FPlatformTime::Seconds() - start) * 1000 / passes;
+		float maxError = 0;
+		for (int32 i = 0; i < sampleCount; i++)
+			maxError = FMath::Max(maxError, FMath::Abs(tableValues[i] - analyticValues[i]));
+		AddInfo(FString::Printf(TEXT("%s: analytic %.3f ms, table %.3f ms, speedup x%.2f, max error %f"), *UEnum::GetValueAsString(ease), analyticMs, tableMs,
+		                        tableMs > 0 ? analyticMs / tableMs : 0, maxError));
+		result += TestTrue(FString::Printf(TEXT("%s Table Matches Analytic"), *UEnum::GetValueAsString(ease)), maxError <= 1e-2f);
+	}
+	// Same ease and parameters share the table.
+	result += TestTrue(TEXT("Table Shared"), FPulseEaseLUT::GetShared(evaluator, EPulseTweenEase::OutBounce, tableSamples) == FPulseEaseLUT::GetShared(
+		                   evaluator, EPulseTweenEase::OutBounce, tableSamples));
+	// A curve over [0-2] is baked over [0-1].
+	UCurveFloat* curve = NewObject<UCurveFloat>();
+	curve->FloatCurve.AddKey(0, 0);
+	curve->FloatCurve.AddKey(2, 1);
+	const FPulseEaseLUT curveTable = FPulseEaseLUT::Bake(curve, tableSamples);
+	result += TestNearlyEqual(TEXT("Curve Baked"), curveTable.Evaluate(0.5f), 0.5f, 1e-3f);
+	return result >= tested + 2;
+}
+
+bool FTweenSubscriptionTest::RunTest(const FString& Parameters)
+{
+	UWorld* world = PulseTweenTest::CreateTestWorld();
+	UPulseTween* tweenSystem = world ? world->GetSubsystem<UPulseTween>() : nullptr;
+	if (!tweenSystem)
+	{
+		PulseTweenTest::DestroyTestWorld(world);
+		return TestNotNull(TEXT("Tween System"), tweenSystem);
+	}
+	FTweenParams params;
+	params.ForwardDuration = 1;
+	const FGuid listenedTween = UPulseTween::Tween(world, FPulseTweenInstance(params));
+	const FGuid otherTween = UPulseTween::Tween(world, FPulseTweenInstance(params));
+	TArray<EPulseTweenEvent> received;
+	bool bOtherTweenReceived = false;
+	const FDelegateHandle handle = tweenSystem->SubscribeToTween(listenedTween, FPulseTweenNativeEvent::FDelegate::CreateLambda(
+		                                                             [&received, &bOtherTweenReceived, listenedTween](const FGuid& TweenID, EPulseTweenEvent Event)
+		                                                             {
+			                                                             bOtherTweenReceived |= TweenID != listenedTween;
+			                                                             received.Add(Event);
+		                                                             }));
+	int result = 0;
+	result += TestTrue(TEXT("Subscribed"), handle.IsValid());
+	tweenSystem->Tick(0); // Activate the new tweens
+	tweenSystem->Tick(0.25f);
+	result += TestTrue(TEXT("Started Received"), received.Contains(EPulseTweenEvent::Started));
+	result += TestTrue(TEXT("Update Received"), received.Contains(EPulseTweenEvent::Update));
+	result += TestFalse(TEXT("Only Listened Tween"), bOtherTweenReceived);
+	// Removed: nothing is received anymore, while the tween goes on.
+	result += TestTrue(TEXT("Unsubscribed"), tweenSystem->UnsubscribeFromTween(listenedTween, handle));
+	received.Reset();
+	tweenSystem->Tick(0.25f);
+	result += TestTrue(TEXT("No Event After Removal"), received.IsEmpty());
+	result += TestTrue(TEXT("Tween Still Active"), tweenSystem->IsActiveTween(listenedTween));
+	result += TestFalse(TEXT("Removed Twice"), tweenSystem->UnsubscribeFromTween(listenedTween, handle));
+	PulseTweenTest::DestroyTestWorld(world);
+	return result >= 8;
+}
+
+bool FTweenGroupTest::RunTest(const FString& Parameters)
+{
+	UWorld* world = PulseTweenTest::CreateTestWorld();
+	UPulseTween* tweenSystem = world ? world->GetSubsystem<UPulseTween>() : nullptr;
+	if (!tweenSystem)
+	{
+		PulseTweenTest::DestroyTestWorld(world);
+		return TestNotNull(TEXT("Tween System"), tweenSystem);
+	}
+	const FName groupName = TEXT("Menu");
+	FTweenParams params;
+	params.ForwardDuration = 1;
+	const FGuid ungroupedTween = UPulseTween::Tween(world, FPulseTweenInstance(params));
+	params.Group = groupName;
+	TArray<FGuid> groupTweens;
+	for (int32 i = 0; i < 3; i++)
+		groupTweens.Add(UPulseTween::Tween(world, FPulseTweenInstance(params)));
+	tweenSystem->Tick(0); // Activate the new tweens
+	auto getProgress = [tweenSystem](const FGuid& TweenID)
+	{
+		float value = 0, percentage = 0;
+		tweenSystem->GetTweenValues(TweenID, value, percentage);
+		return value;
+	};
+	int result = 0;
+	// Paused group: only the ungrouped tween moves.
+	tweenSystem->PauseTweenGroup(groupName);
+	tweenSystem->Tick(0.25f);
+	result += TestTrue(TEXT("Group Paused"), tweenSystem->IsTweenGroupPaused(groupName));
+	result += TestNearlyEqual(TEXT("Paused Group Tween Frozen"), getProgress(groupTweens[0]), 0.0f, 1e-3f);
+	result += TestNearlyEqual(TEXT("Ungrouped Tween Moves"), getProgress(ungroupedTween), 0.25f, 1e-3f);
+	// Resumed at double speed.
+	tweenSystem->ResumeTweenGroup(groupName);
+	tweenSystem->SetTweenGroupTimeScale(groupName, 2);
+	tweenSystem->Tick(0.25f);
+	result += TestNearlyEqual(TEXT("Group Time Scaled"), getProgress(groupTweens[1]), 0.5f, 1e-3f);
+	// Cancelled: the group tweens end, the ones started afterward live on.
+	tweenSystem->CancelTweenGroup(groupName);
+	const FGuid lateTween = UPulseTween::Tween(world, FPulseTweenInstance(params));
+	tweenSystem->Tick(0.1f);
+	bool anyGroupTweenActive = false;
+	for (const FGuid& tweenID : groupTweens)
+		anyGroupTweenActive |= tweenSystem->IsActiveTween(tweenID);
+	result += TestFalse(TEXT("Group Tweens Cancelled"), anyGroupTweenActive);
+	result += TestTrue(TEXT("Ungrouped Tween Still Active"), tweenSystem->IsActiveTween(ungroupedTween));
+	result += TestTrue(TEXT("Late Group Tween Active"), tweenSystem->IsActiveTween(lateTween));
+	PulseTweenTest::DestroyTestWorld(world);
+	return result >= 7;
+}
+
+bool FTweenOwnerLifetimeTest::RunTest(const FString& Parameters)
+{
+	UWorld* world = PulseTweenTest::CreateTestWorld();
+	UPulseTween* tweenSystem = world ? world->GetSubsystem<UPulseTween>() : nullptr;
+	AActor* actor = world ? world->SpawnActor<AActor>() : nullptr;
+	if (!tweenSystem || !actor)
+	{
+		PulseTweenTest::DestroyTestWorld(world);
+		return TestTrue(TEXT("Tween System And Actor"), false);
+	}
+	FTweenParams params;
+	params.ForwardDuration = 10;
+	TArray<FGuid> attachedTweens;
+	for (int32 i = 0; i < 3; i++)
+	{
+		FGuid tweenID;
+		tweenSystem->CreateNewTween(actor, tweenID, params, true);
+		attachedTweens.Add(tweenID);
+	}
+	FGuid freeTween;
+	tweenSystem->CreateNewTween(actor, freeTween, params, false);
+	tweenSystem->Tick(0); // Activate the new tweens
+	int result = 0;
+	result += TestEqual(TEXT("Tweens Active"), tweenSystem->GetActiveTweenCount(), 4);
+	actor->Destroy();
+	tweenSystem->Tick(0.1f);
+	bool anyAttachedActive = false;
+	for (const FGuid& tweenID : attachedTweens)
+		anyAttachedActive |= tweenSystem->IsActiveTween(tweenID);
+	result += TestFalse(TEXT("Attached Tweens Cancelled With Owner"), anyAttachedActive);
+	result += TestTrue(TEXT("Unattached Tween Still Active"), tweenSystem->IsActiveTween(freeTween));
+	PulseTweenTest::DestroyTestWorld(world);
+	return result >= 3;
+}
+
+bool FTweenSequenceTest::RunTest(const FString& Parameters)
+{
+	UWorld* world = PulseTweenTest::CreateTestWorld();
+	UPulseTween* tweenSystem = world ? world->GetSubsystem<UPulseTween>() : nullptr;
+	if (!tweenSystem)
+	{
+		PulseTweenTest::DestroyTestWorld(world);
+		return TestNotNull(TEXT("Tween System"), tweenSystem);
+	}
+	FTweenParams params;
+	params.ForwardDuration = 1;
+	// Two steps, played twice.
+	FGuid sequenceID;
+	tweenSystem->CreateNewSequence(world, sequenceID, {params, params}, 1);
+	FGuid cancelledSequenceID;
+	tweenSystem->CreateNewSequence(world, cancelledSequenceID, {params, params}, -1);
+	tweenSystem->Tick(0); // Activate the first steps
+	tweenSystem->CancelSequence(cancelledSequenceID);
+	FGuid firstStepID, stepID;
+	int32 stepIndex = INDEX_NONE;
+	tweenSystem->GetSequenceCurrentTweenID(sequenceID, firstStepID, stepIndex);
+	// A step runs past its end, completes on the next tick, and is replaced on the one after.
+	auto playStep = [tweenSystem]()
+	{
+		tweenSystem->Tick(1.5f);
+		tweenSystem->Tick(0);
+		tweenSystem->Tick(0);
+	};
+	int result = 0;
+	const int32 expectedIndexes[] = {1, 0, 1};
+	for (const int32 expectedIndex : expectedIndexes)
+	{
+		playStep();
+		result += TestTrue(FString::Printf(TEXT("Moved To Step %d"), expectedIndex),
+		                   tweenSystem->GetSequenceCurrentTweenID(sequenceID, stepID, stepIndex) && stepIndex == expectedIndex);
+		result += TestTrue(TEXT("Step Tween Active"), tweenSystem->IsActiveTween(stepID));
+		result += TestEqual(TEXT("Advanced In Place"), tweenSystem->GetActiveTweenCount(), 1);
+	}
+	result += TestNotEqual(TEXT("Steps Have Their Own ID"), stepID, firstStepID);
+	playStep();
+	int32 stepCount = 0;
+	result += TestFalse(TEXT("Sequence Completed"), tweenSystem->GetSequenceTweenCount(sequenceID, stepCount));
+	result += TestFalse(TEXT("Cancelled Sequence Removed"), tweenSystem->GetSequenceTweenCount(cancelledSequenceID, stepCount));
+	result += TestEqual(TEXT("No Tween Left"), tweenSystem->GetActiveTweenCount(), 0);
+	PulseTweenTest::DestroyTestWorld(world);
+	return result >= 13;
+}
+
+bool FTweenUpdateStressBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 TweenCounts[] = {1000, 10000, 100000};
+	const int32 Ticks = 30;
+	TArray<FString> rows;
+	bool ran = true;
+	for (const int32 count : TweenCounts)
+	{
+		UWorld* world = PulseTweenTest::CreateTestWorld();
+		UPulseTween* tweenSystem = world ? world->GetSubsystem<UPulseTween>() : nullptr;
+		if (!tweenSystem)
+		{
+			PulseTweenTest::DestroyTestWorld(world);
+			return TestNotNull(TEXT("Tween System"), tweenSystem);
+		}
+		const int32 activeCount = PulseTweenTest::SpawnMixedTweens(world, tweenSystem, count);
+		tweenSystem->Tick(0); // Activate the new tweens
+		tweenSystem->SetMultiThreadThreshold(-1);
+		const double singleThreadMs = PulseTweenTest::MeasureTicks(tweenSystem, Ticks);
+		tweenSystem->SetMultiThreadThreshold(1);
+		const double multiThreadMs = PulseTweenTest::MeasureTicks(tweenSystem, Ticks);
+		const double singleThreadNs = singleThreadMs * 1e6 / activeCount;
+		const double multiThreadNs = multiThreadMs * 1e6 / activeCount;
+		AddInfo(FString::Printf(TEXT("%d mixed tweens: single thread %.1f ns/tween, multi thread %.1f ns/tween"), count, singleThreadNs, multiThreadNs));
+		rows.Add(FString::Printf(TEXT("Update,%d,SingleThreadNsPerTween,%.2f"), count, singleThreadNs));
+		rows.Add(FString::Printf(TEXT("Update,%d,MultiThreadNsPerTween,%.2f"), count, multiThreadNs));
+		ran &= TestEqual(FString::Printf(TEXT("%d Tweens Active"), count), tweenSystem->GetActiveTweenCount(), activeCount);
+		PulseTweenTest::DestroyTestWorld(world);
+	}
+	PulseTweenTest::WriteCsvRows(TEXT("TweenUpdate.csv"), rows);
+	return TestTrue(TEXT("Benchmark ran"), ran);
+}
+
+bool FTweenLifecycleBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 TweenCounts[] = {1000, 10000, 100000};
+	const FName group = TEXT("Stress");
+	TArray<FString> rows;
+	bool ran = true;
+	for (const int32 count : TweenCounts)
+	{
+		UWorld* world = PulseTweenTest::CreateTestWorld();
+		UPulseTween* tweenSystem = world ? world->GetSubsystem<UPulseTween>() : nullptr;
+		if (!tweenSystem)
+		{
+			PulseTweenTest::DestroyTestWorld(world);
+			return TestNotNull(TEXT("Tween System"), tweenSystem);
+		}
+		// Creation: the requests, then the tick adding them.
+		double start = FPlatformTime::Seconds();
+		PulseTweenTest::SpawnMixedTweens(world, tweenSystem, count, group);
+		tweenSystem->Tick(0);
+		const double createNs = (FPlatformTime::Seconds() - start) * 1e9 / count;
+		ran &= TestEqual(FString::Printf(TEXT("%d Tweens Created"), count), tweenSystem->GetActiveTweenCount(), count);
+		// Removal: a group cancel, then the tick removing them.
+		start = FPlatformTime::Seconds();
+		tweenSystem->CancelTweenGroup(group);
+		tweenSystem->Tick(0);
+		const double removeNs = (FPlatformTime::Seconds() - start) * 1e9 / count;
+		ran &= TestEqual(FString::Printf(TEXT("%d Tweens Removed"), count), tweenSystem->GetActiveTweenCount(), 0);
+		AddInfo(FString::Printf(TEXT("%d tweens: creation %.1f ns/tween, removal %.1f ns/tween"), count, createNs, removeNs));
+		rows.Add(FString::Printf(TEXT("Lifecycle,%d,CreateNsPerTween,%.2f"), count, createNs));
+		rows.Add(FString::Printf(TEXT("Lifecycle,%d,RemoveNsPerTween,%.2f"), count, removeNs));
+		PulseTweenTest::DestroyTestWorld(world);
+	}
+	PulseTweenTest::WriteCsvRows(TEXT("TweenLifecycle.csv"), rows);
+	return TestTrue(TEXT("Benchmark ran"), ran);
+}
+
+bool FTweenEventDispatchBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 NodeCounts[] = {100, 1000, 10000};
+	const int32 Ticks = 30;
+	TArray<FString> rows;
+	bool ran = true;
+	FTweenParams params;
+	params.ForwardDuration = 1000;
+	for (const int32 count : NodeCounts)
+	{
+		UWorld* world = PulseTweenTest::CreateTestWorld();
+		UPulseTween* tweenSystem = world ? world->GetSubsystem<UPulseTween>() : nullptr;
+		if (!tweenSystem)
+		{
+			PulseTweenTest::DestroyTestWorld(world);
+			return TestNotNull(TEXT("Tween System"), tweenSystem);
+		}
+		// Baseline: the same tweens without anyone listening.
+		for (int32 i = 0; i < count; i++)
+			UPulseTween::Tween(world, FPulseTweenInstance(params));
+		tweenSystem->Tick(0);
+		const double baselineMs = PulseTweenTest::MeasureTicks(tweenSystem, Ticks);
+		tweenSystem->CancelTweenGroup(NAME_None);
+		tweenSystem->Tick(0);
+		// Float nodes subscribe to their tween and receive its update event every tick.
+		TArray<TStrongObjectPtr<UPulseTweenFloatNode>> nodes;
+		for (int32 i = 0; i < count; i++)
+		{
+			nodes.Emplace(UPulseTweenFloatNode::PulseTweenValue(world, params));
+			nodes.Last()->Activate();
+		}
+		tweenSystem->Tick(0);
+		const double nodesMs = PulseTweenTest::MeasureTicks(tweenSystem, Ticks);
+		const double dispatchNs = FMath::Max(nodesMs - baselineMs, 0.0) * 1e6 / count;
+		AddInfo(FString::Printf(TEXT("%d float nodes: %.3f ms/tick against %.3f ms/tick without listener, %.1f ns/event"), count, nodesMs, baselineMs, dispatchNs));
+		rows.Add(FString::Printf(TEXT("EventDispatch,%d,BaselineMsPerTick,%.4f"), count, baselineMs));
+		rows.Add(FString::Printf(TEXT("EventDispatch,%d,NodesMsPerTick,%.4f"), count, nodesMs));
+		rows.Add(FString::Printf(TEXT("EventDispatch,%d,DispatchNsPerNode,%.2f"), count, dispatchNs));
+		ran &= TestEqual(FString::Printf(TEXT("%d Node Tweens Active"), count), tweenSystem->GetActiveTweenCount(), count);
+		nodes.Reset();
+		PulseTweenTest::DestroyTestWorld(world);
+	}
+	PulseTweenTest::WriteCsvRows(TEXT("TweenEventDispatch.csv"), rows);
+	return TestTrue(TEXT("Benchmark ran"), ran);
+}
+
+#endif
@@ -0,0 +1,20 @@
+// Copyright © by Tyni Boat. All Rights Reserved.
+
+#pragma once
+#include "ObjectPooling/IPulsePoolableObject.h"
+#include "PoolingTestTypes.generated.h"
+
+
+// A poolable object refusing the spawn transforms below the ground (Z < 0).
+UCLASS()
+class PULSETESTFRAMEWORK_API UPoolingTestObject : public UObject, public IIPulsePoolableObject
+{
+	GENERATED_BODY()
+
+public:
+	int32 QueryCount = 0;
+	int32 DisposeCount = 0;
+
+	virtual bool OnPoolQueryNative(const FPoolingParamsView& SpawnData) override;
+	virtual void OnPoolDispose_Implementation() override;
+};
@@ -42,6 +42,7 @@ public class PulseTestFramework : ModuleRules
 				"SlateCore",
 				"PulseGameFramework",
 				"DeveloperSettings",
+				"HTTP",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);